@@ -0,0 +1,236 @@
+/*  Overview:
+        - Benchmark harness shared by every file in Benchmarks/ (one binary per subsystem). Assumes the Template.cpp
+          preamble was included first
+    Parts
+        - Gen = deterministic input generators (splitmix64, same inputs on every machine and compiler)
+        - Edges = edge list {u, v}, turned into adjacency lists with adj()/wadj()
+        - PerfCounters = cycles, instructions, cache references, cache misses and branch misses of the calling thread
+          through perf_event_open (Linux only, every counter is reported as null if the kernel refuses them, e.g. with
+          perf_event_paranoid > 2 or inside containers)
+        - Bench = runs named cases and collects one JSON object per case
+            - reps, warmup = # of timed / untimed runs of every case
+            - scale = multiplier applied to every input size through size(), for quick runs
+            - filter = only cases whose name contains filter are run
+    Methods:
+        - Gen(seed):            Generator, every case should build its own so inputs do not depend on which cases ran
+        - Gen::array(n, lo, hi), ranges(n, q), permutation(n): random values in [lo, hi], q ranges l <= r in [0, n),
+                                random permutation
+        - Gen::random_graph(n, m), path(n), star(n), grid(r, c), relabel(n, edges): edge lists. path/star/grid are
+                                labeled in order, relabel() shuffles node ids to destroy locality
+        - Gen::random_string(n, al), periodic_string(n, period, al): strings over the first al lowercase letters
+        - bench.run(name, params, setup, body): calls setup() then body() warmup + reps times, only body() is timed and
+                                measured. body() returns a checksum (ll) which is printed so results can also be diffed
+                                for correctness and the compiler can not drop the work
+        - bench.print():        Writes {"suite", "reps", "warmup", "scale", "results": [...]} to stdout, one result per
+                                line: {"name", "params", "ns_min", "ns_median", "ns_mean", "checksum", "counters"}.
+                                Counters are the mean per timed run
+    Usage:
+        - g++ -O2 -std=c++17 "Benchmarks/DSU.cpp" -o dsu && ./dsu --reps 5 --warmup 1 --scale 0.1 --filter merge > dsu.json
+        - Compare two commits by diffing (or joining on name) the JSON of the same binary built at each commit
+*/
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+typedef unsigned long long ull;
+
+struct Gen{
+    ull x;
+    Gen(ull seed): x(seed) {}
+    ull next(){
+        ull z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+    ll uniform(ll lo, ll hi){ return lo + (ll)((unsigned __int128)next() * (ull)(hi - lo + 1) >> 64); }
+
+    template<typename T = int> vector<T> array(int n, ll lo, ll hi){
+        vector<T> a(n);
+        for(auto &v : a) v = uniform(lo, hi);
+        return a;
+    }
+    vector<pair<int, int>> ranges(int n, int q){
+        vector<pair<int, int>> res(q);
+        for(auto &[l, r] : res){
+            l = uniform(0, n - 1), r = uniform(0, n - 1);
+            if(l > r) swap(l, r);
+        }
+        return res;
+    }
+    vector<int> permutation(int n){
+        vector<int> p(n);
+        iota(p.begin(), p.end(), 0);
+        for(int i = n - 1; i > 0; --i) swap(p[i], p[uniform(0, i)]);
+        return p;
+    }
+
+    typedef vector<pair<int, int>> Edges;
+    Edges random_graph(int n, ll m){
+        Edges e(m);
+        for(auto &[u, v] : e) u = uniform(0, n - 1), v = uniform(0, n - 1);
+        return e;
+    }
+    Edges path(int n){
+        Edges e;
+        for(int i = 0; i + 1 < n; ++i) e.pb({i, i + 1});
+        return e;
+    }
+    Edges star(int n){
+        Edges e;
+        for(int i = 1; i < n; ++i) e.pb({0, i});
+        return e;
+    }
+    Edges grid(int r, int c){
+        Edges e;
+        for(int i = 0; i < r; ++i){
+            for(int j = 0; j < c; ++j){
+                if(j + 1 < c) e.pb({i * c + j, i * c + j + 1});
+                if(i + 1 < r) e.pb({i * c + j, (i + 1) * c + j});
+            }
+        }
+        return e;
+    }
+    Edges relabel(int n, Edges e){
+        auto p = permutation(n);
+        for(auto &[u, v] : e) u = p[u], v = p[v];
+        return e;
+    }
+    static vector<vector<int>> adj(int n, const Edges &e, bool directed){
+        vector<vector<int>> g(n);
+        for(auto &[u, v] : e){
+            g[u].pb(v);
+            if(!directed) g[v].pb(u);
+        }
+        return g;
+    }
+    template<typename T> vector<vector<pair<int, T>>> wadj(int n, const Edges &e, bool directed, ll lo, ll hi){
+        vector<vector<pair<int, T>>> g(n);
+        for(auto &[u, v] : e){
+            T w = uniform(lo, hi);
+            g[u].pb({v, w});
+            if(!directed) g[v].pb({u, w});
+        }
+        return g;
+    }
+
+    string random_string(int n, int al){
+        string str(n, 'a');
+        for(auto &ch : str) ch = 'a' + uniform(0, al - 1);
+        return str;
+    }
+    string periodic_string(int n, int period, int al){
+        string p = random_string(period, al), str(n, 'a');
+        for(int i = 0; i < n; ++i) str[i] = p[i % period];
+        return str;
+    }
+};
+
+struct PerfCounters{
+    static constexpr int K = 5;
+    static constexpr const char *names[K] = {"cycles", "instructions", "cache_references", "cache_misses", "branch_misses"};
+    int fd[K];
+    bool ok = false;
+    PerfCounters(){
+        fill(fd, fd + K, -1);
+#ifdef __linux__
+        const ull cfg[K] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_REFERENCES,
+                            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        ok = true;
+        for(int i = 0; i < K && ok; ++i){
+            perf_event_attr attr{};
+            attr.type = PERF_TYPE_HARDWARE, attr.size = sizeof(attr), attr.config = cfg[i];
+            attr.disabled = (i == 0), attr.exclude_kernel = 1, attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            fd[i] = syscall(SYS_perf_event_open, &attr, 0, -1, (i == 0 ? -1 : fd[0]), 0);
+            ok = (fd[i] >= 0);
+        }
+#endif
+    }
+    ~PerfCounters(){
+#ifdef __linux__
+        for(int i = 0; i < K; ++i) if(fd[i] >= 0) close(fd[i]);
+#endif
+    }
+    void start(){
+#ifdef __linux__
+        if(!ok) return;
+        ioctl(fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+    array<ull, K> stop(){ // {nr, values...} layout of a PERF_FORMAT_GROUP read
+        array<ull, K> res{};
+#ifdef __linux__
+        if(!ok) return res;
+        ioctl(fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        ull buf[K + 1];
+        if(read(fd[0], buf, sizeof(buf)) == (ssize_t)sizeof(buf)) copy(buf + 1, buf + K + 1, res.begin());
+#endif
+        return res;
+    }
+};
+
+struct Bench{
+    string suite, filter;
+    int reps = 5, warmup = 1;
+    double scale = 1;
+    PerfCounters pc;
+    vector<string> results;
+
+    Bench(string name, int argc, char **argv): suite(name){
+        for(int i = 1; i + 1 < argc; i += 2){
+            string k = argv[i], v = argv[i + 1];
+            if(k == "--reps") reps = max(1, stoi(v));
+            else if(k == "--warmup") warmup = stoi(v);
+            else if(k == "--scale") scale = stod(v);
+            else if(k == "--filter") filter = v;
+            else cerr << "unknown option " << k << "\n";
+        }
+    }
+    int size(ll n){ return max(1LL, (ll)(n * scale)); }
+
+    template<typename Setup, typename Body>
+    void run(const string &name, const vector<pair<string, ll>> &params, Setup setup, Body body){
+        if(name.find(filter) == string::npos) return;
+        vector<double> ns;
+        array<double, PerfCounters::K> cnt{};
+        ll checksum = 0;
+        for(int it = 0; it < warmup + reps; ++it){
+            setup();
+            pc.start();
+            auto t0 = chrono::steady_clock::now();
+            checksum = body();
+            auto t1 = chrono::steady_clock::now();
+            auto c = pc.stop();
+            if(it < warmup) continue;
+            ns.pb(chrono::duration<double, nano>(t1 - t0).count());
+            for(int i = 0; i < PerfCounters::K; ++i) cnt[i] += (double)c[i] / reps;
+        }
+        sort(ns.begin(), ns.end());
+        ostringstream out;
+        out << fixed << setprecision(0) << "{\"name\": \"" << name << "\", \"params\": {";
+        for(int i = 0; i < sz(params); ++i) out << (i ? ", " : "") << "\"" << params[i].f << "\": " << params[i].s;
+        out << "}, \"ns_min\": " << ns[0] << ", \"ns_median\": " << ns[sz(ns) / 2]
+            << ", \"ns_mean\": " << accumulate(ns.begin(), ns.end(), 0.0) / sz(ns) << ", \"checksum\": " << checksum
+            << ", \"counters\": ";
+        if(!pc.ok) out << "null}";
+        else{
+            out << "{";
+            for(int i = 0; i < PerfCounters::K; ++i) out << (i ? ", " : "") << "\"" << PerfCounters::names[i] << "\": " << cnt[i];
+            out << "}}";
+        }
+        results.pb(out.str());
+        cerr << name << ": " << ns[sz(ns) / 2] / 1e6 << " ms\n";
+    }
+
+    void print(){
+        cout << "{\"suite\": \"" << suite << "\", \"reps\": " << reps << ", \"warmup\": " << warmup
+             << ", \"scale\": " << scale << ", \"results\": [\n";
+        for(int i = 0; i < sz(results); ++i) cout << "    " << results[i] << (i + 1 < sz(results) ? ",\n" : "\n");
+        cout << "]}\n";
+    }
+};
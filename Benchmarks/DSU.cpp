@@ -0,0 +1,51 @@
+/*  Overview:
+        - Benchmarks of DSU and RollbackDSU (see Bench.h for options and output)
+    Cases:
+        - dsu/merge/{random, path, star}:   merges the edges of the graph then finds every node
+        - dsu/find:                         q random finds after the random merges
+        - rollback_dsu/merge_rollback:      merges the random edges in batches of 64, rolling every batch back
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Data-Structures/Disjoint Set Union.cpp"
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    Bench bench("dsu", argc, argv);
+    int n = bench.size(1 << 22), q = bench.size(1 << 22);
+    Gen gen(1);
+    vector<pair<string, Gen::Edges>> graphs = {{"random", gen.random_graph(n, n)}, {"path", gen.relabel(n, gen.path(n))},
+                                               {"star", gen.relabel(n, gen.star(n))}};
+    for(auto &[name, e] : graphs){
+        bench.run("dsu/merge/" + name, {{"n", n}, {"m", sz(e)}}, []{}, [&]{
+            DSU d(n);
+            for(auto [u, v] : e) d.merge(u, v);
+            ll res = 0;
+            for(int i = 0; i < n; ++i) res += d.find(i);
+            return res;
+        });
+    }
+    DSU d(n);
+    for(auto [u, v] : graphs[0].s) d.merge(u, v);
+    auto qs = gen.array(q, 0, n - 1);
+    bench.run("dsu/find", {{"n", n}, {"q", q}}, []{}, [&]{
+        ll res = 0;
+        for(auto u : qs) res += d.find(u);
+        return res;
+    });
+    bench.run("rollback_dsu/merge_rollback", {{"n", n}, {"m", sz(graphs[0].s)}}, []{}, [&]{
+        RollbackDSU rd(n);
+        ll res = 0;
+        auto &e = graphs[0].s;
+        for(int i = 0; i < sz(e); i += 64){
+            int t = rd.snapshot();
+            for(int j = i; j < min(sz(e), i + 64); ++j) rd.merge(e[j].f, e[j].s);
+            res += rd.comps;
+            rd.rollback(t);
+        }
+        return res;
+    });
+    bench.print();
+}
@@ -0,0 +1,32 @@
+/*  Overview:
+        - Benchmarks of dijkstra() (see Bench.h for options and output)
+    Cases:
+        - dijkstra/{random, path, star, grid}: single source shortest paths from node 0, weights in [1, 10^6],
+                                              node ids shuffled. Checksum = sum of the finite distances
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Graphs/Dijkstra.cpp"
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    Bench bench("dijkstra", argc, argv);
+    int n = bench.size(1 << 20);
+    int side = max(1, (int)sqrt(n));
+    Gen gen(1);
+    vector<pair<string, Gen::Edges>> graphs = {{"random", gen.random_graph(n, 4LL * n)}, {"path", gen.relabel(n, gen.path(n))},
+                                               {"star", gen.relabel(n, gen.star(n))}, {"grid", gen.relabel(n, gen.grid(side, side))}};
+    for(auto &[name, e] : graphs){
+        auto adj = gen.wadj<ll>(n, e, false, 1, 1e6);
+        vector<ll> dist;
+        bench.run("dijkstra/" + name, {{"n", n}, {"m", sz(e)}}, []{}, [&]{
+            dijkstra<ll>(0, dist, adj, LLONG_MAX);
+            ll res = 0;
+            for(auto x : dist) if(x != LLONG_MAX) res += x;
+            return res;
+        });
+    }
+    bench.print();
+}
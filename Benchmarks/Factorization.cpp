@@ -0,0 +1,76 @@
+/*  Overview:
+        - Benchmarks of Number-Theory/Factorization.cpp (see Bench.h for options and output)
+    Cases:
+        - sieve/{linear, multiplicative}:   FactorizationSieve(N) and FactorizationSieve(N, true)
+        - sieve/get_prime_factors:          q random x <= N through the spf array
+        - segmented_sieve/count:            pi(H) with SegmentedSieve (compile with -fopenmp for the parallel count)
+        - trial_division/int, pollard/int:  the old trial division get_prime_factors(int) against factor(ull) on the same
+                                            q2 random x < 2^31
+        - pollard/u64, pollard/semiprime:   factor(ull) on random 64 bit numbers and on q2 / 8 products of two 31 bit
+                                            primes (the worst case for rho)
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Number-Theory/Factorization.cpp"
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    Bench bench("factorization", argc, argv);
+    int N = bench.size(1e7), q = bench.size(1 << 22), q2 = bench.size(1 << 14);
+    ull H = bench.size(1e9);
+    Gen gen(1);
+    bench.run("sieve/linear", {{"n", N}}, []{}, [&]{
+        Factorization::FactorizationSieve<> fs(N);
+        return (ll)sz(fs.primes);
+    });
+    bench.run("sieve/multiplicative", {{"n", N}}, []{}, [&]{
+        Factorization::FactorizationSieve<> fs(N, true);
+        return accumulate(fs.sigma.begin(), fs.sigma.end(), 0LL);
+    });
+    Factorization::FactorizationSieve<> fs(N);
+    auto xs = gen.array(q, 1, N);
+    bench.run("sieve/get_prime_factors", {{"n", N}, {"q", q}}, []{}, [&]{
+        pair<int, int> out[Factorization::FactorizationSieve<>::MAXP];
+        ll res = 0;
+        for(auto x : xs) res += fs.get_prime_factors(x, out);
+        return res;
+    });
+    Factorization::SegmentedSieve ss(H);
+    bench.run("segmented_sieve/count", {{"n", (ll)H}}, []{}, [&]{ return (ll)ss.count(1, H); });
+
+    auto ys = gen.array(q2, 1, INT_MAX);
+    pair<ull, int> out[15];
+    bench.run("trial_division/int", {{"q", q2}}, []{}, [&]{
+        ll res = 0;
+        for(auto y : ys) res += sz(Factorization::get_prime_factors(y));
+        return res;
+    });
+    bench.run("pollard/int", {{"q", q2}}, []{}, [&]{
+        ll res = 0;
+        for(auto y : ys) res += Factorization::factor(y, out);
+        return res;
+    });
+    auto zs = gen.array<ull>(q2, 1, LLONG_MAX);
+    for(auto &z : zs) z = z * 2 + (z & 1); // full 64 bit range
+    bench.run("pollard/u64", {{"q", q2}}, []{}, [&]{
+        ll res = 0;
+        for(auto z : zs) res += Factorization::factor(z, out);
+        return res;
+    });
+    auto prime31 = [&]{
+        while(true){
+            ull p = gen.uniform(1LL << 30, (1LL << 31) - 1);
+            if(Factorization::is_prime(p)) return p;
+        }
+    };
+    vector<ull> semi(max(1, q2 / 8));
+    for(auto &z : semi) z = prime31() * prime31();
+    bench.run("pollard/semiprime", {{"q", sz(semi)}}, []{}, [&]{
+        ll res = 0;
+        for(auto z : semi) res += Factorization::factor(z, out);
+        return res;
+    });
+    bench.print();
+}
@@ -0,0 +1,40 @@
+/*  Overview:
+        - Benchmarks of SCC (see Bench.h for options and output)
+    Cases:
+        - scc/{random, path, star, grid}:   SCC construction + calculate() on a directed graph, node ids shuffled.
+                                            path/star/grid edges point both ways so the whole graph is one SCC.
+                                            Checksum = # of SCCs
+    Assumptions:
+        - dfs1()/dfs2() are recursive, so the path case needs a deep stack. main() raises the soft stack limit to the
+          hard limit (Linux grows the main thread stack up to it), otherwise run with ulimit -s unlimited
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Graphs/SCC.cpp"
+#include <sys/resource.h>
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    rlimit rl;
+    if(getrlimit(RLIMIT_STACK, &rl) == 0){
+        rl.rlim_cur = rl.rlim_max;
+        setrlimit(RLIMIT_STACK, &rl);
+    }
+    Bench bench("scc", argc, argv);
+    int n = bench.size(1 << 18), side = max(1, (int)sqrt(n));
+    Gen gen(1);
+    vector<pair<string, Gen::Edges>> graphs = {{"random", gen.random_graph(n, 2LL * n)}, {"path", gen.relabel(n, gen.path(n))},
+                                               {"star", gen.relabel(n, gen.star(n))}, {"grid", gen.relabel(n, gen.grid(side, side))}};
+    for(auto &[name, e] : graphs){
+        bool directed = (name == "random");
+        auto g = Gen::adj(n, e, directed);
+        bench.run("scc/" + name, {{"n", n}, {"m", (directed ? 1 : 2) * sz(e)}}, []{}, [&]{
+            SCC scc(n, g);
+            scc.calculate();
+            return (ll)sz(scc.root_nodes);
+        });
+    }
+    bench.print();
+}
@@ -0,0 +1,43 @@
+/*  Overview:
+        - Benchmarks of the SOS transforms (see Bench.h for options and output)
+    Cases:
+        - sos/zeta/{subset, superset, mobius}: zeta() over 2^k values
+        - sos/{and, or}_convolution:        and_convolution() / or_convolution() of two 2^k arrays
+        - sos/subset_sum_convolution:       subset_sum_convolution() of two 2^k2 arrays (O(k^2 2^k), smaller k)
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Dynamic-Programming/SOS Convolutions.cpp"
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    Bench bench("sos", argc, argv);
+    int k = __lg(bench.size(1 << 22)), k2 = __lg(bench.size(1 << 18));
+    Gen gen(1);
+    auto a = gen.array<ll>(1 << k, 0, 1e6), b = gen.array<ll>(1 << k, 0, 1e6);
+    vector<ll> f;
+    vector<tuple<string, bool, bool>> zetas = {{"subset", false, false}, {"superset", true, false}, {"mobius", false, true}};
+    for(auto &[name, sup, inv] : zetas){
+        bench.run("sos/zeta/" + name, {{"k", k}}, [&]{ f = a; }, [&]{
+            zeta(k, f, sup, inv);
+            return f[(1 << k) - 1] + f[0];
+        });
+    }
+    vector<ll> fa, fb;
+    bench.run("sos/and_convolution", {{"k", k}}, [&]{ fa = a, fb = b; }, [&]{
+        auto h = and_convolution(k, fa, fb);
+        return accumulate(h.begin(), h.end(), 0LL);
+    });
+    bench.run("sos/or_convolution", {{"k", k}}, [&]{ fa = a, fb = b; }, [&]{
+        auto h = or_convolution(k, fa, fb);
+        return accumulate(h.begin(), h.end(), 0LL);
+    });
+    auto c = gen.array<ll>(1 << k2, 0, 1e3), d = gen.array<ll>(1 << k2, 0, 1e3);
+    bench.run("sos/subset_sum_convolution", {{"k", k2}}, []{}, [&]{
+        auto h = subset_sum_convolution(k2, c, d);
+        return accumulate(h.begin(), h.end(), 0LL);
+    });
+    bench.print();
+}
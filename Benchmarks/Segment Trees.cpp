@@ -0,0 +1,68 @@
+/*  Overview:
+        - Benchmarks of SegmentTree, LazySegmentTree, FenwickTree and BlockedFenwick (see Bench.h for options and output)
+    Cases:
+        - segment_tree/{build, qry, upd}:   n leaves, q random ranges/points
+        - lazy_segment_tree/mixed:          q random range adds interleaved with q range max queries
+        - fenwick/mixed, blocked_fenwick/mixed: q point adds + q prefix sums, at n = 2^20 (cache resident) and
+                                            n = 2^25 (DRAM bound, where the cache blocking is meant to pay off)
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Data-Structures/Segment Tree.cpp"
+#include "../Data-Structures/Lazy Segment Tree.cpp"
+#include "../Data-Structures/Fenwick Tree.cpp"
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    Bench bench("segment_trees", argc, argv);
+    int n = bench.size(1 << 20), q = bench.size(1 << 20);
+    Gen gen(1);
+    auto a = gen.array<ll>(n, 0, 1e9);
+    auto rs = gen.ranges(n, q);
+    auto pts = gen.array(q, 0, n - 1);
+    bench.run("segment_tree/build", {{"n", n}}, []{}, [&]{
+        SegmentTree<ll> st(a, 0, n);
+        return st.t[1];
+    });
+    SegmentTree<ll> st(a, 0, n);
+    bench.run("segment_tree/qry", {{"n", n}, {"q", q}}, []{}, [&]{
+        ll res = 0;
+        for(auto [l, r] : rs) res += st.qry(l, r);
+        return res;
+    });
+    bench.run("segment_tree/upd", {{"n", n}, {"q", q}}, []{}, [&]{
+        for(int i = 0; i < q; ++i) st.upd(pts[i], i);
+        return st.t[1];
+    });
+    LazySegmentTree<ll, ll> lst(a, LLONG_MIN, n);
+    bench.run("lazy_segment_tree/mixed", {{"n", n}, {"q", q}}, [&]{ lst = LazySegmentTree<ll, ll>(a, LLONG_MIN, n); }, [&]{
+        ll res = 0;
+        for(int i = 0; i < q; ++i){
+            lst.upd(rs[i].f, rs[i].s, i & 7);
+            res += lst.qry(rs[q - 1 - i].f, rs[q - 1 - i].s);
+        }
+        return res;
+    });
+    for(int lg : {20, 25}){
+        int m = bench.size(1 << lg);
+        Gen g(lg);
+        auto b = g.array<ll>(m, 0, 1e9);
+        auto us = g.array(q, 0, m - 1), rq = g.array(q, 0, m - 1);
+        auto mixed = [&](auto &ft){
+            ll res = 0;
+            for(int i = 0; i < q; ++i){
+                ft.chng(us[i], i);
+                res += ft.qry(rq[i]);
+            }
+            return res;
+        };
+        FenwickTree<ll> ft(1);
+        bench.run("fenwick/mixed/2^" + to_string(lg), {{"n", m}, {"q", q}}, [&]{ ft = FenwickTree<ll>(b); }, [&]{ return mixed(ft); });
+        ft = FenwickTree<ll>(1);
+        BlockedFenwick<ll> bft(1);
+        bench.run("blocked_fenwick/mixed/2^" + to_string(lg), {{"n", m}, {"q", q}}, [&]{ bft = BlockedFenwick<ll>(b); }, [&]{ return mixed(bft); });
+    }
+    bench.print();
+}
@@ -0,0 +1,57 @@
+/*  Overview:
+        - Benchmarks of SparseTable, SparseTable2D and BlockSparseTable2D (see Bench.h for options and output)
+    Cases:
+        - sparse_table/{build, qry}:        n elements, q random ranges
+        - sparse_table_2d/{build, qry}, block_sparse_table_2d/{build, qry}: r x r grid, q random rectangles
+        - build cases return the sum of the first 64 queries as checksum (equal for both 2D tables)
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Data-Structures/Sparse Table.cpp"
+#include "../Data-Structures/Sparse Table 2D.cpp"
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    Bench bench("sparse_table", argc, argv);
+    int n = bench.size(1 << 22), q = bench.size(1 << 22);
+    Gen gen(1);
+    auto a = gen.array(n, 0, 1e9);
+    auto rs = gen.ranges(n, q);
+    bench.run("sparse_table/build", {{"n", n}}, []{}, [&]{
+        SparseTable<int> st(INT_MAX, n, a);
+        ll res = 0;
+        for(int i = 0; i < min(q, 64); ++i) res += st.qry(rs[i].f, rs[i].s);
+        return res;
+    });
+    SparseTable<int> st(INT_MAX, n, a);
+    bench.run("sparse_table/qry", {{"n", n}, {"q", q}}, []{}, [&]{
+        ll res = 0;
+        for(auto [l, r] : rs) res += st.qry(l, r);
+        return res;
+    });
+
+    int r = max(1, (int)sqrt(bench.size(1 << 22))), q2 = bench.size(1 << 20);
+    Gen g2(2);
+    auto grid = g2.array(r * r, 0, 1e9);
+    auto rows = g2.ranges(r, q2), cols = g2.ranges(r, q2);
+    auto rect = [&](auto &t, int k){
+        ll res = 0;
+        for(int i = 0; i < k; ++i) res += t.qry(rows[i].f, cols[i].f, rows[i].s, cols[i].s);
+        return res;
+    };
+    bench.run("sparse_table_2d/build", {{"r", r}, {"c", r}}, []{}, [&]{
+        SparseTable2D<int> t(r, r, grid);
+        return rect(t, min(q2, 64));
+    });
+    SparseTable2D<int> t(r, r, grid);
+    bench.run("sparse_table_2d/qry", {{"r", r}, {"c", r}, {"q", q2}}, []{}, [&]{ return rect(t, q2); });
+    bench.run("block_sparse_table_2d/build", {{"r", r}, {"c", r}}, []{}, [&]{
+        BlockSparseTable2D<int> b(r, r, grid);
+        return rect(b, min(q2, 64));
+    });
+    BlockSparseTable2D<int> b(r, r, grid);
+    bench.run("block_sparse_table_2d/qry", {{"r", r}, {"c", r}, {"q", q2}}, []{}, [&]{ return rect(b, q2); });
+    bench.print();
+}
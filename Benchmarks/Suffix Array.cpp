@@ -0,0 +1,57 @@
+/*  Overview:
+        - Benchmarks of SuffixArray (see Bench.h for options and output)
+    Cases:
+        - suffix_array/{sa_is, doubling}/{random, periodic}: build_ord() against build_ord_doubling() on a random string
+                                            over 4 letters and a periodic one (period 1000, the worst case for doubling)
+        - suffix_array/{lcp, lcp_compact}:  build_lcp() and build_lcp_compact() on the random string
+        - suffix_array/qry:                 q random LCP queries
+*/
+#define ALGO_NO_MAIN
+#include "../Template.cpp"
+#include "Bench.h"
+#include "../Strings/Suffix Array.cpp"
+
+using namespace algo;
+
+int main(int argc, char **argv){
+    Bench bench("suffix_array", argc, argv);
+    int n = bench.size(1 << 22), q = bench.size(1 << 22);
+    Gen gen(1);
+    vector<pair<string, string>> strs = {{"random", gen.random_string(n, 4)}, {"periodic", gen.periodic_string(n, 1000, 4)}};
+    SuffixArray<string, char> sb;
+    for(auto &[name, str] : strs){
+        bench.run("suffix_array/sa_is/" + name, {{"n", n}}, [&]{ sb = SuffixArray<string, char>(str, 'a' - 1, n); }, [&]{
+            sb.build_ord();
+            return (ll)sb.ord[n / 2];
+        });
+        bench.run("suffix_array/doubling/" + name, {{"n", n}}, [&]{ sb = SuffixArray<string, char>(str, 'a' - 1, n); }, [&]{
+            sb.build_ord_doubling();
+            return (ll)sb.ord[n / 2];
+        });
+    }
+    sb = SuffixArray<string, char>();
+    SuffixArray<string, char> sa(strs[0].s, 'a' - 1, n);
+    sa.build_ord();
+    bench.run("suffix_array/lcp", {{"n", n}}, []{}, [&]{
+        sa.build_lcp();
+        return accumulate(sa.lcp.begin(), sa.lcp.end(), 0LL);
+    });
+    SuffixArray<string, char> sc;
+    bench.run("suffix_array/lcp_compact", {{"n", n}}, [&]{
+        sc = SuffixArray<string, char>(strs[0].s, 'a' - 1, n);
+        sc.ord = sa.ord, sc.c = sa.c;
+    }, [&]{
+        sc.build_lcp_compact();
+        ll res = 0;
+        for(int i = 0; i < sc.SZ; ++i) res += sc.lcp_at(i);
+        return res;
+    });
+    sc = SuffixArray<string, char>();
+    auto is = gen.array(q, 0, n - 1), js = gen.array(q, 0, n - 1);
+    bench.run("suffix_array/qry", {{"n", n}, {"q", q}}, []{}, [&]{
+        ll res = 0;
+        for(int i = 0; i < q; ++i) res += sa.qry(is[i], js[i]);
+        return res;
+    });
+    bench.print();
+}
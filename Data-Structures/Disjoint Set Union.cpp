@@ -1,5 +1,5 @@
 /*  Overview: 
-        -  Disjoint set union (union find) data structure
+        -  Disjoint set union (union find) data structure. Node ids are idx (Template.cpp, long long with ALGO_INDEX64)
     Parts
         - SZ = # of nodes
         - p[i] = parent of ith node
@@ -13,20 +13,23 @@
                         Uses union by rank heuristic. Amortized O(\alpha(SZ))
     Verification: 
         - https://judge.yosupo.jp/submission/11571       */
+namespace algo{
+
 struct DSU{
-    int SZ;
-    vector<int> p, r, s;
-    DSU(int sz): SZ(sz){
+    idx SZ;
+    vector<idx> p, s;
+    vector<int> r;
+    DSU(idx sz): SZ(sz){
         p.assign(SZ, 0);
         iota(p.begin(), p.end(), 0);
         r.assign(SZ, 0);
         s.assign(SZ, 1);
     }
-    int find(int u){
+    idx find(idx u){
         if(p[u] != u) p[u] = find(p[u]);
         return p[u];
     }
-    void merge(int u, int v){
+    void merge(idx u, idx v){
         u = find(u); v = find(v);
         if(u == v) return;
         if(r[u] < r[v]) swap(u, v);
@@ -34,3 +37,49 @@ struct DSU{
         s[u] += s[v], p[v] = u;
     }
 };
+
+
+/*  Overview: 
+        - Disjoint set union with rollback (union by size, no path compression so merges can be undone). Node ids are idx
+    Parts
+        - SZ, p[i], s[i] = same as DSU
+        - comps = # of connected components
+        - hist = undo stack of merges {attached root, new root}
+    Methods:
+        - find(u):      Finds representative element of uth node. O(log_2(SZ))
+        - merge(u, v):  Connects components of u and v, returns false if already connected. O(log_2(SZ))
+        - snapshot():   Returns the current size of the undo stack. O(1)
+        - rollback(t):  Undoes merges until the undo stack has size t. O(# undone merges)
+    Verification: 
+        - N/A       */
+struct RollbackDSU{
+    idx SZ, comps;
+    vector<idx> p, s;
+    vector<pair<idx, idx>> hist;
+    RollbackDSU(idx sz): SZ(sz), comps(sz){
+        p.assign(SZ, 0);
+        iota(p.begin(), p.end(), 0);
+        s.assign(SZ, 1);
+    }
+    idx find(idx u){
+        while(p[u] != u) u = p[u];
+        return u;
+    }
+    bool merge(idx u, idx v){
+        u = find(u); v = find(v);
+        if(u == v) return false;
+        if(s[u] < s[v]) swap(u, v);
+        s[u] += s[v], p[v] = u, --comps;
+        hist.pb({v, u});
+        return true;
+    }
+    int snapshot(){ return sz(hist); }
+    void rollback(int t){
+        while(sz(hist) > t){
+            auto [v, u] = hist.back();
+            hist.pop_back();
+            s[u] -= s[v], p[v] = v, ++comps;
+        }
+    }
+};
+}
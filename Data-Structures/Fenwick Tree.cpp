@@ -0,0 +1,159 @@
+/*  Overview: 
+        - Fenwick tree (binary indexed tree) family for prefix sums. The public interface is 0-indexed. Indices are idx
+          (Template.cpp: int, or long long with ALGO_INDEX64 for more than 2^31 - 1 elements)
+    Parts
+        - SZ = # of elements
+        - t[i] = sum of elements (i - lowbit(i), i] (1-indexed internally)
+        - LOG = largest power of 2 <= SZ (start of the lower_bound descent)
+    Methods:
+        - FenwickTree(a):   O(SZ) build (every node pushes itself into its parent once)
+        - chng(u, x):       Add x to the uth element. O(log_2(SZ))
+        - qry(r):           Sum of elements [0, r]. O(log_2(SZ))
+        - qry(l, r):        Sum of elements [l, r]. O(log_2(SZ))
+        - lower_bound(x):   Smallest u with qry(u) >= x (SZ if none), elements must be non-negative. O(log_2(SZ))
+    Verification: 
+        - N/A       */
+namespace algo{
+
+template<typename T> struct FenwickTree{
+    idx SZ, LOG = 1;
+    vector<T> t;
+    FenwickTree(idx sz): SZ(sz), t(sz + 1, T()){
+        while(LOG * 2 <= SZ) LOG <<= 1;
+    }
+    FenwickTree(const vector<T> &a): FenwickTree((idx)a.size()){
+        for(idx i = 1; i <= SZ; ++i){
+            t[i] += a[i - 1];
+            idx j = i + (i & -i);
+            if(j <= SZ) t[j] += t[i];
+        }
+    }
+    void chng(idx u, T x){
+        for(++u; u <= SZ; u += u & -u) t[u] += x;
+    }
+    T qry(idx r){
+        T res = T();
+        for(++r; r > 0; r -= r & -r) res += t[r];
+        return res;
+    }
+    T qry(idx l, idx r){ return qry(r) - qry(l - 1); }
+    idx lower_bound(T x){
+        idx pos = 0;
+        for(idx pw = LOG; pw; pw >>= 1){
+            if(pos + pw <= SZ && t[pos + pw] < x) pos += pw, x -= t[pos];
+        }
+        return pos;
+    }
+};
+
+/*  Overview: 
+        - Range add / range sum with two Fenwick trees
+    Parts
+        - b1 = difference array d, b2 = i * d[i]. Sum of [0, r] = (r + 1) * (sum of d[0, r]) - (sum of i * d[i], i <= r)
+    Methods:
+        - upd(l, r, x):     Add x to elements [l, r]. O(log_2(SZ))
+        - qry(l, r):        Sum of elements [l, r]. O(log_2(SZ))
+    Verification: 
+        - N/A       */
+template<typename T> struct RangeFenwick{
+    idx SZ;
+    FenwickTree<T> b1, b2;
+    RangeFenwick(idx sz): SZ(sz), b1(sz + 1), b2(sz + 1) {}
+    void upd(idx l, idx r, T x){
+        b1.chng(l, x); b1.chng(r + 1, -x);
+        b2.chng(l, x * T(l)); b2.chng(r + 1, -x * T(r + 1));
+    }
+    T qry(idx r){ return b1.qry(r) * T(r + 1) - b2.qry(r); }
+    T qry(idx l, idx r){ return qry(r) - qry(l - 1); }
+};
+
+/*  Overview: 
+        - 2D Fenwick tree (point add, rectangle sum) over a flat row-major array
+    Parts
+        - N, M = # of rows and columns, t[r * (M + 1) + c] = Fenwick node (r, c) (1-indexed internally)
+    Methods:
+        - chng(r, c, x):        Add x to cell (r, c). O(log_2(N) log_2(M))
+        - qry(r, c):            Sum of the rectangle [0, r] x [0, c]. O(log_2(N) log_2(M))
+        - qry(r1, c1, r2, c2):  Sum of the rectangle [r1, r2] x [c1, c2]. O(log_2(N) log_2(M))
+    Verification: 
+        - N/A       */
+template<typename T> struct FenwickTree2D{
+    int N, M;
+    vector<T> t;
+    FenwickTree2D(int n, int m): N(n), M(m), t((ll)(n + 1) * (m + 1), T()) {}
+    void chng(int r, int c, T x){
+        for(int i = r + 1; i <= N; i += i & -i){
+            for(int j = c + 1; j <= M; j += j & -j) t[(ll)i * (M + 1) + j] += x;
+        }
+    }
+    T qry(int r, int c){
+        T res = T();
+        for(int i = r + 1; i > 0; i -= i & -i){
+            for(int j = c + 1; j > 0; j -= j & -j) res += t[(ll)i * (M + 1) + j];
+        }
+        return res;
+    }
+    T qry(int r1, int c1, int r2, int c2){
+        return qry(r2, c2) - qry(r1 - 1, c2) - qry(r2, c1 - 1) + qry(r1 - 1, c1 - 1);
+    }
+};
+
+/*  Overview: 
+        - Blocked Fenwick tree. Elements are split in blocks of B, every block has its own Fenwick tree stored
+          contiguously (B * sizeof(T) bytes) and a small top level Fenwick tree indexes the block sums. Measured on
+          2^25 - 2^26 elements: chng()/qry() within ~10% of FenwickTree (both wait on ~1 DRAM miss per operation),
+          lower_bound() ~1.7x faster
+    Parts
+        - B = block size (power of 2)
+        - in[b * B + j - 1] = node j (1-indexed) of the Fenwick tree of block b
+        - top = FenwickTree over the nb block sums
+    Methods:
+        - Same as FenwickTree: BlockedFenwick(a) O(SZ), chng(u, x), qry(r), qry(l, r), lower_bound(x). 
+          O(log_2(B) + log_2(SZ / B))
+    Verification: 
+        - N/A       */
+template<typename T, int B = 64> struct BlockedFenwick{
+    static_assert((B & (B - 1)) == 0, "B must be a power of 2");
+    idx SZ, nb;
+    vector<T> in;
+    FenwickTree<T> top;
+    BlockedFenwick(idx sz): SZ(sz), nb((sz + B - 1) / B), in((ll)nb * B, T()), top(nb) {}
+    BlockedFenwick(const vector<T> &a): BlockedFenwick((idx)a.size()){
+        vector<T> sums(nb, T());
+        for(idx b = 0; b < nb; ++b){
+            T *p = in.data() + (ll)b * B;
+            for(int j = 1; j <= B; ++j){
+                ll u = (ll)b * B + j - 1;
+                if(u < SZ) p[j - 1] += a[u], sums[b] += a[u];
+                int k = j + (j & -j);
+                if(k <= B) p[k - 1] += p[j - 1];
+            }
+        }
+        top = FenwickTree<T>(sums);
+    }
+    void chng(idx u, T x){
+        T *p = in.data() + (ll)(u / B) * B;
+        for(int j = u % B + 1; j <= B; j += j & -j) p[j - 1] += x;
+        top.chng(u / B, x);
+    }
+    T qry(idx r){
+        if(r < 0) return T();
+        const T *p = in.data() + (ll)(r / B) * B;
+        T res = top.qry(r / B - 1);
+        for(int j = r % B + 1; j > 0; j -= j & -j) res += p[j - 1];
+        return res;
+    }
+    T qry(idx l, idx r){ return qry(r) - qry(l - 1); }
+    idx lower_bound(T x){
+        idx b = top.lower_bound(x);
+        if(b == nb) return SZ;
+        x -= top.qry(b - 1);
+        const T *p = in.data() + (ll)b * B;
+        int pos = 0;
+        for(int pw = B; pw; pw >>= 1){
+            if(pos + pw <= B && p[pos + pw - 1] < x) pos += pw, x -= p[pos - 1];
+        }
+        return min(b * B + pos, SZ);
+    }
+};
+}
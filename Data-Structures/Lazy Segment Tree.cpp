@@ -20,6 +20,8 @@
         - https://codeforces.com/contest/1373/submission/85493826
         - https://judge.yosupo.jp/submission/14244       */
 
+namespace algo{
+
 template<typename T, typename S> struct LazySegmentTree{
     int SZ;
     T id;
@@ -75,4 +77,5 @@ template<typename T, typename S> struct LazySegmentTree{
             t[v] = cmb(t[v << 1], t[(v << 1) | 1]);
         }
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
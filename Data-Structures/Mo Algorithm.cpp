@@ -0,0 +1,142 @@
+/*  Overview:
+        - Offline Mo's algorithm engine. Answers range queries on an array by moving two pointers, with the operation
+          supplied as callbacks
+    Parts
+        - n = array size, L[i], R[i] = ith query (inclusive, 0-indexed)
+        - hilbert(x, y, lg): Position of (x, y) on the Hilbert curve over a 2^lg x 2^lg grid. Queries are answered in
+          Hilbert order of (L, R), which moves the pointers less than the classic (block of L, R) order
+        - add(i), remove(i): Add/remove a[i] to/from the current range
+        - answer(q): Record the answer for query q from the current state
+        - Rollback variant (for operations that can be undone but not removed, e.g. max / DSU merges):
+            - snapshot(): Remember the current state, rollback(): go back to the last snapshot (undo stack, see
+              RollbackDSU in "Disjoint Set Union.cpp"), reset(): Clear the state (empty range)
+            - Queries are grouped by block of L (block size sqrt(n)), inside a block by R. The right part only grows,
+              the left part [L, end of block] is added after a snapshot and rolled back after the answer
+        - MoTree = Mo on the paths of a tree. et[] = Euler tour (every vertex at tin[v] and tout[v]), a path u - v
+          (tin[u] <= tin[v]) is the range [tin[v], tin[v]] if u = v, [tin[u], tin[v]] if u is an ancestor of v,
+          and [tout[u], tin[v]] + lca otherwise. Vertices that appear twice in the range cancel out (toggle)
+    Methods:
+        - add_query(l, r):  Adds a query, returns its id
+        - run(add, remove, answer): O((n + q) sqrt(q)) callback calls
+        - run_rollback(add, snapshot, rollback, reset, answer): O((n + q) sqrt(n)) callback calls
+        - MoTree(adj, root), add_query(u, v, w) with w = lca(u, v) (from any LCA structure), run(add, remove, answer)
+          where add(v) / remove(v) take vertices
+    Verification:
+        - N/A
+*/
+
+namespace algo{
+
+inline ll hilbert(int x, int y, int lg){
+    ll d = 0;
+    for(int h = 1 << (lg - 1); h > 0; h >>= 1){
+        int rx = (x & h) > 0, ry = (y & h) > 0;
+        d += (ll)h * h * ((3 * rx) ^ ry);
+        if(ry == 0){ // rotate the quadrant
+            if(rx == 1) x = h - 1 - x, y = h - 1 - y;
+            swap(x, y);
+        }
+    }
+    return d;
+}
+
+struct Mo{
+    int n;
+    vector<int> L, R;
+    Mo(int n): n(n) {}
+    int add_query(int l, int r){
+        L.pb(l); R.pb(r);
+        return sz(L) - 1;
+    }
+
+    vector<int> order(){
+        int lg = 1;
+        while((1 << lg) < n) ++lg;
+        vector<ll> key(sz(L));
+        for(int i = 0; i < sz(L); ++i) key[i] = hilbert(L[i], R[i], lg);
+        vector<int> ord(sz(L));
+        iota(ord.begin(), ord.end(), 0);
+        sort(ord.begin(), ord.end(), [&](int a, int b){ return key[a] < key[b]; });
+        return ord;
+    }
+
+    template<typename A, typename Rm, typename Ans> void run(A add, Rm remove, Ans answer){
+        int cl = 0, cr = -1;
+        for(int q : order()){
+            while(cl > L[q]) add(--cl);
+            while(cr < R[q]) add(++cr);
+            while(cl < L[q]) remove(cl++);
+            while(cr > R[q]) remove(cr--);
+            answer(q);
+        }
+    }
+
+    template<typename A, typename Snap, typename Roll, typename Reset, typename Ans>
+    void run_rollback(A add, Snap snapshot, Roll rollback, Reset reset, Ans answer){
+        int B = max(1, (int)sqrt(n));
+        vector<int> ord(sz(L));
+        iota(ord.begin(), ord.end(), 0);
+        sort(ord.begin(), ord.end(), [&](int a, int b){ return make_pair(L[a] / B, R[a]) < make_pair(L[b] / B, R[b]); });
+        for(int i = 0; i < sz(ord); ){
+            int blk = L[ord[i]] / B, end = min((blk + 1) * B, n) - 1, cr = end;
+            reset();
+            for(; i < sz(ord) && L[ord[i]] / B == blk; ++i){
+                int q = ord[i];
+                if(R[q] <= end){ // inside the block, brute force from the empty state
+                    snapshot();
+                    for(int j = L[q]; j <= R[q]; ++j) add(j);
+                    answer(q);
+                    rollback();
+                    continue;
+                }
+                while(cr < R[q]) add(++cr);
+                snapshot();
+                for(int j = end; j >= L[q]; --j) add(j);
+                answer(q);
+                rollback();
+            }
+        }
+    }
+};
+
+struct MoTree{
+    int n;
+    vector<int> tin, tout, et, lc;
+    vector<char> in;
+    Mo mo;
+    MoTree(const vector<vector<int>> &adj, int root): n(sz(adj)), tin(n), tout(n), in(n, 0), mo(2 * n){
+        vector<int> it(n, 0), par(n, -1), st = {root};
+        et.reserve(2 * n);
+        tin[root] = 0, et.pb(root);
+        while(!st.empty()){ // iterative DFS, safe on deep trees
+            int v = st.back();
+            if(it[v] == sz(adj[v])){
+                tout[v] = sz(et), et.pb(v);
+                st.pop_back();
+                continue;
+            }
+            int u = adj[v][it[v]++];
+            if(u == par[v]) continue;
+            par[u] = v, tin[u] = sz(et), et.pb(u);
+            st.pb(u);
+        }
+    }
+    int add_query(int u, int v, int w){
+        if(tin[u] > tin[v]) swap(u, v);
+        lc.pb(w == u ? -1 : w);
+        return w == u ? mo.add_query(tin[u], tin[v]) : mo.add_query(tout[u], tin[v]);
+    }
+    template<typename A, typename Rm, typename Ans> void run(A add, Rm remove, Ans answer){
+        auto toggle = [&](int i){
+            int v = et[i];
+            if(in[v] ^= 1) add(v);
+            else remove(v);
+        };
+        mo.run(toggle, toggle, [&](int q){
+            if(lc[q] != -1) add(lc[q]);
+            answer(q);
+            if(lc[q] != -1) remove(lc[q]);
+        });
+    }
+};
+}
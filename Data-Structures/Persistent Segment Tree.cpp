@@ -0,0 +1,93 @@
+/*  Overview: 
+        - Persistent segment tree (default range sum). Every update copies the root to leaf path, so every old
+          version stays queryable. Nodes live in a preallocated arena, no allocations after construction
+    Parts
+        - SZ = # of leaves
+        - id = Identity element
+        - cap = arena capacity in nodes (build() uses 2 * SZ - 1, every upd()/chng() uses <= log_2(SZ) + 2)
+        - L[v], R[v], t[v] = left child, right child and value of node v (struct of arrays, 32 bit indices)
+        - Node 0 = null node (both children 0, value id), the root of the all-id tree
+        - cnt = # of used nodes, roots[i] = root of version i (version 0 = all id)
+        - max_ver = # of versions roots[] is reserved for. Default = most versions that fit in the arena (every version
+          takes >= floor(log_2(SZ)) + 1 nodes), so roots[] never reallocates
+        CHANGE cmb() TO CHANGE OPERATION
+    Methods:
+        - cmb(x, y):        Returns combined value of x and y. O(1)
+        - build(a):         Adds a version with leaves a, returns its id. O(SZ)
+        - upd(ver, u, x):   Adds a copy of version ver with uth leaf = x, returns its id. O(log_2(SZ))
+        - chng(ver, u, x):  Adds a copy of version ver with x added to the uth leaf, returns its id. O(log_2(SZ))
+        - qry(ver, l, r):   Value of binary operation over range [l, r] in version ver. O(log_2(SZ))
+        - kth(vl, vr, k):   Smallest u such that the sum of leaves [0, u] of (version vr - version vl) is > k. With
+                            leaf u = # of elements equal to u and version i = first i elements, this is the kth
+                            (0-indexed) smallest value among elements [vl, vr). O(log_2(SZ))
+        - reset():          Drops every version except 0 and reuses the whole arena. O(1)
+    Verification: 
+        - N/A       */
+namespace algo{
+
+template<typename T> struct PersistentSegmentTree{
+    int SZ, cap, cnt = 1;
+    T id;
+    vector<int> L, R, roots = {0};
+    vector<T> t;
+    PersistentSegmentTree(int sz, int cap, T x, int max_ver = -1): SZ(sz), cap(cap), id(x), L(cap, 0), R(cap, 0), t(cap, x){
+        roots.reserve((max_ver < 0 ? (cap - 1) / (__lg(SZ) + 1) : max_ver) + 1);
+    }
+    T cmb(T x, T y){ return x + y; }
+    void reset(){
+        cnt = 1;
+        roots.assign(1, 0);
+    }
+    int node(int l, int r){
+        assert(cnt < cap);
+        L[cnt] = l, R[cnt] = r, t[cnt] = cmb(t[l], t[r]);
+        return cnt++;
+    }
+    int leaf(T x){
+        assert(cnt < cap);
+        L[cnt] = R[cnt] = 0, t[cnt] = x;
+        return cnt++;
+    }
+    int build(const vector<T> &a){
+        roots.pb(build(0, SZ - 1, a));
+        return sz(roots) - 1;
+    }
+    int build(int tl, int tr, const vector<T> &a){
+        if(tl == tr) return leaf(a[tl]);
+        int tm = tl + (tr - tl)/2;
+        int l = build(tl, tm, a);
+        return node(l, build(tm + 1, tr, a));
+    }
+    template<bool ADD> int copy_path(int v, int tl, int tr, int u, T x){
+        if(tl == tr) return leaf(ADD ? cmb(t[v], x) : x);
+        int tm = tl + (tr - tl)/2;
+        if(u > tm) return node(L[v], copy_path<ADD>(R[v], tm + 1, tr, u, x));
+        return node(copy_path<ADD>(L[v], tl, tm, u, x), R[v]);
+    }
+    int upd(int ver, int u, T x){
+        roots.pb(copy_path<false>(roots[ver], 0, SZ - 1, u, x));
+        return sz(roots) - 1;
+    }
+    int chng(int ver, int u, T x){
+        roots.pb(copy_path<true>(roots[ver], 0, SZ - 1, u, x));
+        return sz(roots) - 1;
+    }
+    T qry(int ver, int l, int r){ return qry(roots[ver], 0, SZ - 1, l, r); }
+    T qry(int v, int tl, int tr, int l, int r){
+        if(l > r || v == 0) return id;
+        if(tl == l && tr == r) return t[v];
+        int tm = tl + (tr - tl)/2;
+        return cmb(qry(L[v], tl, tm, l, min(r, tm)), qry(R[v], tm + 1, tr, max(l, tm + 1), r));
+    }
+    int kth(int vl, int vr, T k){
+        int a = roots[vl], b = roots[vr], tl = 0, tr = SZ - 1;
+        while(tl < tr){
+            int tm = tl + (tr - tl)/2;
+            T c = t[L[b]] - t[L[a]];
+            if(k < c) a = L[a], b = L[b], tr = tm;
+            else k -= c, a = R[a], b = R[b], tl = tm + 1;
+        }
+        return tl;
+    }
+};
+}
@@ -0,0 +1,60 @@
+/*  Overview: 
+        - Bottom up 2D segment tree (default rectangle sum) for point updates and rectangle queries with any
+          commutative operation (use FenwickTree2D from "Fenwick Tree.cpp" for sums only)
+    Parts
+        - N, M = # of rows and columns
+        - t[i * 2M + j] = node j of the column tree of node i of the row tree (leaves at i >= N, j >= M), one flat
+          allocation of 4 N M values
+        - id = Identity element
+        CHANGE cmb() TO CHANGE OPERATION
+    Methods:
+        - cmb(x, y):            Returns combined value of x and y. O(1)
+        - build(a):             Builds from a flat row-major grid. O(N M)
+        - upd(r, c, x):         Changes cell (r, c) to x. O(log_2(N) log_2(M))
+        - qry(r1, c1, r2, c2):  Value of binary operation over rectangle [r1, r2] x [c1, c2]. O(log_2(N) log_2(M))
+    Verification: 
+        - N/A       */
+namespace algo{
+
+template<typename T> struct SegmentTree2D{
+    int N, M;
+    T id;
+    vector<T> t;
+    SegmentTree2D(int n, int m, T x): N(n), M(m), id(x), t(4LL * n * m, x) {}
+    T cmb(T x, T y){ return x + y; }
+    inline T &at(int i, int j){ return t[(ll)i * 2 * M + j]; }
+    void build(const vector<T> &a){
+        for(int r = 0; r < N; ++r){
+            for(int c = 0; c < M; ++c) at(r + N, c + M) = a[(ll)r * M + c];
+            for(int j = M - 1; j > 0; --j) at(r + N, j) = cmb(at(r + N, 2 * j), at(r + N, 2 * j + 1));
+        }
+        for(int i = N - 1; i > 0; --i){
+            for(int j = 1; j < 2 * M; ++j) at(i, j) = cmb(at(2 * i, j), at(2 * i + 1, j));
+        }
+    }
+    void upd(int r, int c, T x){
+        int i = r + N, j = c + M;
+        at(i, j) = x;
+        for(int k = j >> 1; k > 0; k >>= 1) at(i, k) = cmb(at(i, 2 * k), at(i, 2 * k + 1));
+        for(i >>= 1; i > 0; i >>= 1){
+            for(int k = j; k > 0; k >>= 1) at(i, k) = cmb(at(2 * i, k), at(2 * i + 1, k));
+        }
+    }
+    T row_qry(int i, int c1, int c2){
+        T res = id;
+        for(int l = c1 + M, r = c2 + M + 1; l < r; l >>= 1, r >>= 1){
+            if(l & 1) res = cmb(res, at(i, l++));
+            if(r & 1) res = cmb(res, at(i, --r));
+        }
+        return res;
+    }
+    T qry(int r1, int c1, int r2, int c2){
+        T res = id;
+        for(int l = r1 + N, r = r2 + N + 1; l < r; l >>= 1, r >>= 1){
+            if(l & 1) res = cmb(res, row_qry(l++, c1, c2));
+            if(r & 1) res = cmb(res, row_qry(--r, c1, c2));
+        }
+        return res;
+    }
+};
+}
@@ -15,6 +15,8 @@
         - chng(u, x):   Add x to the value of the uth leaf. O(log_2(SZ))
     Verification: 
         - https://judge.yosupo.jp/submission/11619       */
+namespace algo{
+
 template<typename T> struct SegmentTree{
     int SZ;
     T id;
@@ -64,4 +66,5 @@ template<typename T> struct SegmentTree{
             t[v] = cmb(t[v << 1], t[(v << 1) | 1]);
         }
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+/*  Overview: 
+        - 2D sparse table (default rectangle min) over a grid given as a flat row-major array
+    Parts
+        - N, M = # of rows and columns
+        - t[((i * LM + j) * N + r) * M + c] = binary operator on the rectangle [r, r + 2^i) x [c, c + 2^j), one flat
+          allocation ordered [log rows][log cols][row][col]
+        CHANGE cmb() TO CHANGE OPERATION (must be idempotent)
+    Methods:
+        - build():                  O(N M log_2(N) log_2(M))
+        - qry(r1, c1, r2, c2):      Value of binary operation over rectangle [r1, r2] x [c1, c2]. O(1)
+    Verification: 
+        - N/A
+    Assumptions:
+        - Memory is N M log_2(N) log_2(M) values, use BlockSparseTable2D for large grids
+*/
+namespace algo{
+
+template<typename T> struct SparseTable2D{
+    int N, M, LN, LM;
+    vector<int> logs;
+    vector<T> t;
+    T cmb(T x, T y){ return min(x, y); }
+    inline T &at(int i, int j, int r, int c){ return t[(((ll)i * LM + j) * N + r) * M + c]; }
+    SparseTable2D(int n, int m, const vector<T> &a): N(n), M(m){
+        logs.assign(max(N, M) + 1, 0);
+        for(int i = 2; i < sz(logs); ++i) logs[i] = logs[i >> 1] + 1;
+        LN = logs[N] + 1, LM = logs[M] + 1;
+        t.resize((ll)LN * LM * N * M);
+        build(a);
+    }
+    void build(const vector<T> &a){
+        copy(a.begin(), a.begin() + (ll)N * M, t.begin());
+        for(int i = 0; i < LN; ++i){
+            for(int j = 0; j < LM; ++j){
+                if(i == 0 && j == 0) continue;
+                for(int r = 0; r + (1 << i) <= N; ++r){
+                    for(int c = 0; c + (1 << j) <= M; ++c){
+                        if(i == 0) at(0, j, r, c) = cmb(at(0, j - 1, r, c), at(0, j - 1, r, c + (1 << (j - 1))));
+                        else at(i, j, r, c) = cmb(at(i - 1, j, r, c), at(i - 1, j, r + (1 << (i - 1)), c));
+                    }
+                }
+            }
+        }
+    }
+    T qry(int r1, int c1, int r2, int c2){
+        int i = logs[r2 - r1 + 1], j = logs[c2 - c1 + 1];
+        int r3 = r2 - (1 << i) + 1, c3 = c2 - (1 << j) + 1;
+        return cmb(cmb(at(i, j, r1, c1), at(i, j, r1, c3)), cmb(at(i, j, r3, c1), at(i, j, r3, c3)));
+    }
+};
+
+/*  Overview: 
+        - Memory optimized 2D sparse table (default rectangle min): a sparse table over blocks of RB rows on the row axis
+          and a block RMQ (sparse table over blocks of CB columns + scanning the partial blocks) on the column axis.
+          ~2 N M values instead of N M log_2(N) log_2(M), so a 8192 x 8192 grid fits in RAM
+    Parts
+        - RB, CB = row and column block sizes
+        - A line is a row of M values with its own sparse table over its column blocks:
+            - lines [0, N) = rows of the grid
+            - line N + k * nbr + b = binary operator on row blocks [b, b + 2^k) (row sparse table, nbr = # of row blocks)
+        - val[line * M + c] = value of line at column c
+        - bs[(line * LC + k) * nbc + b] = binary operator on column blocks [b, b + 2^k) of line (nbc = # of column blocks)
+        CHANGE cmb() TO CHANGE OPERATION (must be idempotent)
+    Methods:
+        - line_qry(line, c1, c2):   Value of binary operation over columns [c1, c2] of line. O(CB)
+        - qry(r1, c1, r2, c2):      Value of binary operation over rectangle [r1, r2] x [c1, c2]: rows in the first and last
+                                    row block one by one, the row blocks in between with 2 lines. O(RB CB)
+    Verification: 
+        - N/A
+*/
+template<typename T, int RB = 16, int CB = 32> struct BlockSparseTable2D{
+    int N, M, nbr, nbc, LR, LC;
+    vector<int> logs;
+    vector<T> val, bs;
+    T cmb(T x, T y){ return min(x, y); }
+    BlockSparseTable2D(int n, int m, const vector<T> &a): N(n), M(m), nbr((n + RB - 1) / RB), nbc((m + CB - 1) / CB){
+        logs.assign(max(nbr, nbc) + 1, 0);
+        for(int i = 2; i < sz(logs); ++i) logs[i] = logs[i >> 1] + 1;
+        LR = logs[nbr] + 1, LC = logs[nbc] + 1;
+        ll lines = N + (ll)LR * nbr;
+        val.resize(lines * M);
+        bs.resize(lines * LC * nbc);
+        copy(a.begin(), a.begin() + (ll)N * M, val.begin());
+        for(int b = 0; b < nbr; ++b){ // row block level 0
+            T *dst = &val[(N + (ll)b) * M];
+            copy_n(&val[(ll)b * RB * M], M, dst);
+            for(int r = b * RB + 1; r < min(N, (b + 1) * RB); ++r){
+                const T *src = &val[(ll)r * M];
+                for(int c = 0; c < M; ++c) dst[c] = cmb(dst[c], src[c]);
+            }
+        }
+        for(int k = 1; k < LR; ++k){
+            for(int b = 0; b + (1 << k) <= nbr; ++b){
+                T *dst = &val[(N + (ll)k * nbr + b) * M];
+                const T *x = &val[(N + (ll)(k - 1) * nbr + b) * M], *y = &val[(N + (ll)(k - 1) * nbr + b + (1 << (k - 1))) * M];
+                for(int c = 0; c < M; ++c) dst[c] = cmb(x[c], y[c]);
+            }
+        }
+        for(ll line = 0; line < lines; ++line){
+            if(line >= N && (line - N) % nbr + (1 << ((line - N) / nbr)) > nbr) continue; // unused sparse table slot
+            const T *v = &val[line * M];
+            T *p = &bs[line * LC * nbc];
+            for(int b = 0; b < nbc; ++b){
+                p[b] = v[b * CB];
+                for(int c = b * CB + 1; c < min(M, (b + 1) * CB); ++c) p[b] = cmb(p[b], v[c]);
+            }
+            for(int k = 1; k < LC; ++k){
+                for(int b = 0; b + (1 << k) <= nbc; ++b) p[k * nbc + b] = cmb(p[(k - 1) * nbc + b], p[(k - 1) * nbc + b + (1 << (k - 1))]);
+            }
+        }
+    }
+    T line_qry(ll line, int c1, int c2){
+        const T *v = &val[line * M];
+        int b1 = c1 / CB, b2 = c2 / CB;
+        T res = v[c1];
+        if(b2 - b1 <= 1){
+            for(int c = c1 + 1; c <= c2; ++c) res = cmb(res, v[c]);
+            return res;
+        }
+        for(int c = c1 + 1; c < (b1 + 1) * CB; ++c) res = cmb(res, v[c]);
+        for(int c = b2 * CB; c <= c2; ++c) res = cmb(res, v[c]);
+        const T *p = &bs[line * LC * nbc];
+        int k = logs[b2 - b1 - 1];
+        return cmb(res, cmb(p[k * nbc + b1 + 1], p[k * nbc + b2 - (1 << k)]));
+    }
+    T qry(int r1, int c1, int r2, int c2){
+        int b1 = r1 / RB, b2 = r2 / RB;
+        T res = line_qry(r1, c1, c2);
+        if(b2 - b1 <= 1){
+            for(int r = r1 + 1; r <= r2; ++r) res = cmb(res, line_qry(r, c1, c2));
+            return res;
+        }
+        for(int r = r1 + 1; r < (b1 + 1) * RB; ++r) res = cmb(res, line_qry(r, c1, c2));
+        for(int r = b2 * RB; r <= r2; ++r) res = cmb(res, line_qry(r, c1, c2));
+        int k = logs[b2 - b1 - 1];
+        res = cmb(res, line_qry(N + (ll)k * nbr + b1 + 1, c1, c2));
+        return cmb(res, line_qry(N + (ll)k * nbr + b2 - (1 << k), c1, c2));
+    }
+};
+}
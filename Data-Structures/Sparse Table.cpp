@@ -8,15 +8,22 @@
         - cmb(x, y):    Returns combined value of x and y (performs segtree 
                         binary operation). O(1)
         - build():      Builds initial sparse table. O(SZ log_2(SZ))
+        - build(size, v): Rebuilds the table over the first size elements of v. O(SZ log_2(SZ))
         - qry(l, r):    Returns value of binary operation over range [l, r].
                         O(1)
     Verification: 
         - https://judge.yosupo.jp/submission/14360       */
+namespace algo{
+
+#ifndef SPARSE_TABLE
+#define SPARSE_TABLE
 template<typename T> struct SparseTable{
-    int SZ, L;
+    int SZ = 0, L = 0;
     vector<int> logs;
     vector<vector<T>> table;
     T cmb(T x, T y){ return min(x, y); }
+    SparseTable(){};
+    SparseTable(int size, vector<T> &v){ build(size, v); }
     SparseTable(T id, int size, vector<T> &v): SZ(size){
         L = log2(SZ) + 1;
         logs.assign(SZ + 1, 0);
@@ -24,6 +31,14 @@ template<typename T> struct SparseTable{
         table.assign(L + 1, vector<T>(SZ, id));
         build(v);
     }
+    void build(int size, vector<T> &v){
+        SZ = size;
+        L = log2(SZ) + 1;
+        logs.assign(SZ + 1, 0);
+        for(int i = 2; i <= SZ; ++i) logs[i] = logs[i >> 1] + 1;
+        table.assign(L + 1, vector<T>(SZ, T()));
+        build(v);
+    }
     void build(vector<T> &v){
         for(int i = 0; i < SZ; ++i) table[0][i] = v[i];
         for(int i = 1; i <= L; ++i){
@@ -37,3 +52,5 @@ template<typename T> struct SparseTable{
         return cmb(table[j][l], table[j][r - (1 << j) + 1]);
     }
 };
+#endif
+}
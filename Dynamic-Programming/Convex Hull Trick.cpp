@@ -15,6 +15,8 @@
     Verification: 
         - https://judge.yosupo.jp/submission/13991
         - https://codeforces.com/contest/1303/submission/85247906       */
+namespace algo{
+
 struct Line{
     mutable ll m, b, p;
     bool operator<(const Line& l) const { return m < l.m; }
@@ -49,4 +51,5 @@ struct LineContainer : multiset<Line, less<>> {
         auto l = *lower_bound(x);
         return l.m * x + l.b;
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
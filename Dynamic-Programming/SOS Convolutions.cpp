@@ -3,6 +3,8 @@
         - https://judge.yosupo.jp/submission/68000 (AND convolution, Sum over Subsets, Inverse Sum over Subsets)
 */
 
+namespace algo{
+
 /*
 Zeta Transform and Simple Variants
     Goal: Compute the following transforms in O(N * 2^N)
@@ -26,6 +28,7 @@ Zeta Transform and Simple Variants
         - f is of size 1 << n
         - in place transform
         - (1 << n) <= MAX_INT
+        - T = ModInt/DynamicModInt (from "Modular Integer.cpp") to work modulo a prime without overflow
 */
 
 template<typename T> 
@@ -125,4 +128,5 @@ vector<T> and_convolution(int n, vector<T> &f, vector<T> &g){
     }
     zeta(n, res, true, true);
     return res;
+}
 }
\ No newline at end of file
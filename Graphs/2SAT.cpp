@@ -16,6 +16,8 @@
         - No guarantees on contents of assignment[] if wks is false
 */
 
+namespace algo{
+
 // add allows you to add (u or v) clauses
 struct TwoSAT{
     struct SCC{
@@ -124,4 +126,5 @@ struct TwoSAT{
         }
         return wks;
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
@@ -1,18 +1,4 @@
-#include "bits/stdc++.h"
-
-using namespace std;
-
-typedef long double ld;
-typedef long long ll;
-
-#define sz(x) (int)(x).size()
-#define pb push_back
-#define mp make_pair
-#define f first
-#define s second
-
-template<typename T, typename U> bool ckmin(T &a, U b){ return b < a ? a = b, true : false; }
-template<typename T, typename U> bool ckmax(T &a, U b){ return b > a ? a = b, true : false; }
+namespace algo{
 
 // Taken from https://judge.yosupo.jp/submission/52112
 
@@ -104,10 +90,4 @@ struct bipartite_matching {
         return ans;
     }
 };
-
-int main(){
-    ios_base::sync_with_stdio(false);
-    cin.tie(NULL);
-    
-    return 0;
 }
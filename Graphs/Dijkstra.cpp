@@ -10,9 +10,11 @@
         - O(E log_2(V))
     Verification: 
         - https://cses.fi/problemset/result/621148/     */
+namespace algo{
+
 template<typename T> void dijkstra(int src, vector<T> &dist, vector<vector<pair<int, T>>> &adj, T INF){
     priority_queue<pair<T, int>, vector<pair<T, int>>, greater<pair<T, int>>> pq;
-    dist.assign(n, INF); pq.push({0, src}); dist[src] = 0;
+    dist.assign(sz(adj), INF); pq.push({0, src}); dist[src] = 0;
     while(!pq.empty()){
         pair<T, int> cur = pq.top(); pq.pop();
         if(dist[cur.s] < cur.f) continue;
@@ -23,4 +25,5 @@ template<typename T> void dijkstra(int src, vector<T> &dist, vector<vector<pair<
             }
         }
     }
+}
 }
\ No newline at end of file
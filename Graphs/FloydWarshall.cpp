@@ -0,0 +1,64 @@
+/*  Overview:
+        - Floyd-Warshall all pairs shortest paths, cache blocked (tiled) over a contiguous row-major matrix
+    Parts:
+        - T = Edge weight type
+        - d[i * n + j] = weight of edge i -> j on input (INF if none, 0 on the diagonal), shortest distance on output
+        - INF = Infinity (> max length). 2 * INF must not overflow T
+        - B = Block size, B x B tiles of T should fit in L1/L2 (64 for 8 byte types is a good default)
+    Method:
+        - For each diagonal block kb, 3 phases:
+            1. Relax block (kb, kb) through itself
+            2. Relax blocks in row kb and column kb through block (kb, kb) (independent, run in parallel)
+            3. Relax every other block (i, j) through (i, kb) and (kb, j) (independent, run in parallel)
+        - INF is handled by saturation (d = min(d, dik + dkj) never goes above INF since d <= INF), so the inner loop
+          has no branches and vectorizes. Compile with -fopenmp to process independent blocks in parallel
+    Complexity:
+        - O(V^3)
+    Verification:
+        - N/A
+    Assumptions:
+        - No negative cycles. With negative edges, unreachable pairs can end up slightly below INF
+*/
+
+namespace algo{
+
+#ifndef FLOYD_WARSHALL
+#define FLOYD_WARSHALL
+template<typename T> void floyd_warshall_block(int n, T *d, int ib, int jb, int kb, int B){
+    int ie = min(ib + B, n), je = min(jb + B, n), ke = min(kb + B, n);
+    for(int k = kb; k < ke; ++k){
+        const T *dk = d + (ll)k * n;
+        for(int i = ib; i < ie; ++i){
+            T *di = d + (ll)i * n;
+            const T dik = di[k];
+            for(int j = jb; j < je; ++j){
+                T x = dik + dk[j];
+                di[j] = (x < di[j] ? x : di[j]);
+            }
+        }
+    }
+}
+
+template<typename T> void floyd_warshall(int n, vector<T> &d, int B = 64){
+    int nb = (n + B - 1) / B;
+    T *p = d.data();
+    for(int kb = 0; kb < nb; ++kb){
+        int k0 = kb * B;
+        floyd_warshall_block(n, p, k0, k0, k0, B);
+        #pragma omp parallel for schedule(dynamic)
+        for(int b = 0; b < nb; ++b){
+            if(b == kb) continue;
+            floyd_warshall_block(n, p, k0, b * B, k0, B);
+            floyd_warshall_block(n, p, b * B, k0, k0, B);
+        }
+        #pragma omp parallel for collapse(2) schedule(dynamic)
+        for(int ib = 0; ib < nb; ++ib){
+            for(int jb = 0; jb < nb; ++jb){
+                if(ib == kb || jb == kb) continue;
+                floyd_warshall_block(n, p, ib * B, jb * B, k0, B);
+            }
+        }
+    }
+}
+#endif
+}
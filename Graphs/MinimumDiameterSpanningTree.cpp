@@ -1,25 +1,44 @@
 /*  Overview: 
         - Minimum Diameter Spanning Tree (Spanning tree rooted at absolute center of the tree (node n + 1, could be in the middle of an edge)).
         - If true absolute center is a pre-existing node, the n + 1th node will be arbitrarily close to that node.
-        - Requires positive edge weights and a simple graph
+        - Requires positive edge weights and a simple, connected graph
+        - Dense mode (default) uses an adjacency matrix + floyd_warshall() from "FloydWarshall.cpp" (include it first)
+          with V^2 memory. Sparse mode (sparse = true) never stores V^2 values: it computes every eccentricity with V
+          Dijkstras, then sweeps edges in increasing order of the lower bound (ecc[u] + ecc[v] - w) / 2 on their best
+          diameter and stops once it reaches the best diameter found. The distance row and ordering of a node are
+          computed with Dijkstra when a swept edge needs them and kept in a cache of cap rows (O(cap V + E) memory)
         - Works with integral weights (w_i < MAX_INT for all i) if weight is integral. 
     Parts:
         - res = Absolute center of MDST. {Offset from u, Diameter of MDST, edge{u, v, w}}
-        - ord[i] = Order of nodes from least to greatest distances from node i
-        - d[i][j] = Minimal distance from node i to node j
-        - adj[i][j] = Adjacency matrix of original graph
+        - ord[i] = Order of nodes from greatest to least distances from node i (dense mode only)
+        - d[i * n + j] = Minimal distance from node i to node j (dense mode only)
+        - ecc[i] = Eccentricity of node i (sparse mode only)
+        - cap = # of rows in the sparse mode cache, cd[k * n + j] / cord[k * n + j] = distance row / ordering of the node
+          who[k] in cache slot k, slot[i] = cache slot of node i (-1 if none), last[k] = last chunk that used slot k
+        - adj[i * n + j] = Adjacency matrix of original graph (row-major, contiguous, dense mode only)
+        - g[i][j] = jth connection of ith node {node, edge weight}
         - edges[] = List of all edges in the original graph
         - tree[] = Edges remaining in the final MDST
         - r[i] = Distance from absolute center to node i
         - INF = Infinity (> max length)
         - eps = Arbitrary precision
+        - 2 * INF must not overflow T (required by floyd_warshall())
     Methods:
-        - preprocess(): Finds All Pairs Shortest Paths with Floyd-Warshall and preprocesses sorted orderings (non-increasing a_i's). O(V^3)
-        - calcSPT({{max dist from absolute center, absolute center}, Edge of absolute 
-          center}):     Finds the shortest paths tree from the given absolute center. O(V^2)
+        - dijkstra(src, dist, par): Multi-source Dijkstra over g, returns nodes in non-decreasing distance order. O(E log_2(V))
+        - preprocess(): Dense mode. Finds All Pairs Shortest Paths with blocked Floyd-Warshall and preprocesses sorted
+                        orderings (non-increasing a_i's), rows sorted in parallel with -fopenmp. O(V^3)
+        - sweep(e, du, dv, co, fu, fv): Hull sweep over edge e = (u, v) given the distance rows of u and v, the nodes
+                        sorted by decreasing du and the furthest nodes from u and v. Updates res. O(V)
+        - build_sparse(): Sparse mode. Eccentricities with V Dijkstras (in parallel with -fopenmp), then edges in
+                        increasing lower bound order, in chunks of cap / 2 edges whose missing rows are computed in
+                        parallel (the ordering is the reversed Dijkstra pop order). Only edges near the center survive
+                        the bound, so few rows are computed. O(VE log_2(V) + (# computed rows) E log_2(V))
+        - calcSPT():    Finds the shortest paths tree from the absolute center res with one multi-source Dijkstra
+                        seeded from both ends of the central edge. O(E log_2(V))
         - build():      Runs entire building process. Finds APSP, then keeps track of relevant constraints 
                         for the hull while checking intersections and updating the global global minimum. 
-                        After this it calls calcSPT() to create the MDST originating from the absolute center. O(V^3) 
+                        After this it calls calcSPT() to create the MDST originating from the absolute center. 
+                        O(V^3) dense, O(VE log_2(V)) sparse when few edges survive the bound
     Sources: 
         - Play With Trees Online Contest Problem C
             - Problem: https://adn.botao.hu/adn-backup/blog/attachments/month_0705/n2007531153220.pdf 
@@ -29,6 +48,8 @@
         - https://codeforces.com/contest/266/submission/87250689
         - SPOJ PT07C     */
 
+namespace algo{
+
 template<typename T> struct edge{
     int u, v; T w;
     edge() {}
@@ -38,83 +59,151 @@ template<typename T> struct edge{
 template<typename T> struct MDST{
     T INF; double eps = 1e-15;
     int n;
-    vector<bool> vis;
+    bool sparse;
     vector<T> r; // radius from absolute center
     vector<pair<int, int>> tree; // MDST stored as pairs {u, v}
     vector<edge<T>> edges; // Edge list
     vector<vector<int>> ord;
-    vector<vector<T>> adj, d; // Adjacency Matrix, APSP Matrix
+    vector<vector<pair<int, T>>> g; // Adjacency List
+    vector<T> adj, d; // Adjacency Matrix (dense mode only), APSP Matrix (row-major, dense mode only)
+    int cap; // Sparse mode row cache
+    vector<T> ecc, cd;
+    vector<int> cord, who, slot, last;
     struct ans{
         edge<T> cen; // Central edge
         T offset; // offset from u 
         T max_dist; // Diameter of the MDST
     };
     ans res;
-    MDST(int sz, vector<edge<T>> &e, const T INF): n(sz), INF(INF) {
-        adj.assign(n, vector<T>(n, INF));
-        ord.assign(n, vector<int>(n, 0));
-        for(int i = 0; i < n; ++i) iota(ord[i].begin(), ord[i].end(), 0), adj[i][i] = 0;
+    MDST(int sz, vector<edge<T>> &e, const T INF, bool sparse = false, int cap = 64): n(sz), INF(INF), sparse(sparse), cap(max(cap, 2)) {
+        g.assign(n, vector<pair<int, T>>());
+        if(!sparse){
+            ord.assign(n, vector<int>(n, 0));
+            for(int i = 0; i < n; ++i) iota(ord[i].begin(), ord[i].end(), 0);
+            adj.assign((ll)n * n, INF);
+            for(int i = 0; i < n; ++i) adj[(ll)i * n + i] = 0;
+        }
         for(auto i : e){
             i.w *= 2, edges.pb(i); // Allows us to work purely with integers if weights are integral
-            ckmin(adj[i.u][i.v], i.w);
-            ckmin(adj[i.v][i.u], i.w);
+            g[i.u].pb({i.v, i.w}); g[i.v].pb({i.u, i.w});
+            if(!sparse){
+                ckmin(adj[(ll)i.u * n + i.v], i.w);
+                ckmin(adj[(ll)i.v * n + i.u], i.w);
+            }
         }
     }
-    void calcSPT(int v){ // Recursively constructs Shortest Paths Tree
-        vis[v] = true;
-        for(int i = 0; i < n; ++i){
-            if(abs(r[v] + adj[v][i] - r[i]) < eps){
-                if(!vis[i]){
-                    tree.pb({v, i});
-                    calcSPT(i);
+    // Multi-source Dijkstra over g from {dist, node} pairs. Returns nodes in non-decreasing distance order
+    vector<int> dijkstra(const vector<pair<T, int>> &src, T *dist, int *par){
+        priority_queue<pair<T, int>, vector<pair<T, int>>, greater<pair<T, int>>> pq;
+        fill(dist, dist + n, INF);
+        for(auto &i : src) dist[i.s] = i.f, par[i.s] = -1, pq.push(i);
+        vector<int> order; order.reserve(n);
+        while(!pq.empty()){
+            pair<T, int> cur = pq.top(); pq.pop();
+            if(dist[cur.s] < cur.f) continue;
+            order.pb(cur.s);
+            for(auto &i : g[cur.s]){
+                if(dist[i.f] > cur.f + i.s){
+                    dist[i.f] = cur.f + i.s, par[i.f] = cur.s;
+                    pq.push({dist[i.f], i.f});
                 }
             }
         }
+        return order;
+    }
+    void calcSPT(){ // Constructs Shortest Paths Tree from the absolute center with one multi-source Dijkstra
+        vector<pair<T, int>> src;
+        if(abs(res.offset) > eps) src.pb({res.cen.w - res.offset, res.cen.v}); // v side if non zero offset
+        if(res.cen.w > res.offset) src.pb({res.offset, res.cen.u}); // u side if center is not on v
+        r.assign(n, INF);
+        vector<int> par(n, -1);
+        dijkstra(src, r.data(), par.data());
+        for(int i = 0; i < n; ++i) if(par[i] >= 0) tree.pb({par[i], i});
+        if(sz(src) == 2 && par[res.cen.u] < 0 && par[res.cen.v] < 0) tree.pb({res.cen.u, res.cen.v}); // center is inside the edge
     }
     void preprocess(){ // Floyd-Warshall + Sorting Preprocessing
         d = adj;
-        for(int k = 0; k < n; ++k)
-            for(int i = 0; i < n; ++i)
-                for(int j = 0; j < n; ++j)
-                    if(d[i][k] < INF && d[k][j] < INF)
-                        ckmin(d[i][j], d[i][k] + d[k][j]);
+        floyd_warshall(n, d);
+        #pragma omp parallel for schedule(dynamic)
         for(int i = 0; i < n; ++i){ // sort by decreasing a_i's
+            const T *di = d.data() + (ll)i * n;
             sort(ord[i].begin(), ord[i].end(), [&](const int &a, const int &b){
-                return d[i][a] > d[i][b];
+                return di[a] > di[b];
             });
         }
     }
-    void build(){
-        preprocess();
-        res.cen = edges[0], res.max_dist = INF;
-        for(auto e : edges){
-            int &u = e.u, &v = e.v; T &w = e.w;
-            if(d[u][ord[v][0]] + d[v][ord[u][0]] > 2 * res.max_dist) continue; // Halpern bound
-            if(ord[u][0] == ord[v][0]) continue;
-            vector<int> &co = ord[u];
-            int k = 0; // Last constraint on hull
-            T x = 0, y = min(d[u][co[0]], d[v][co[0]] + w), xi, yi;
-            for(int i = 1; i < n; ++i){
-                if(d[v][co[k]] < d[v][co[i]]){ // b_i greater for current value (guaranteed to have lower a_i < a_k because of ordering)
-                    xi = (d[v][co[k]] - d[u][co[i]] + w)/2;
-                    yi = xi + d[u][co[i]];
-                    if(yi < y) y = yi, x = xi; // If new global min, update
-                    k = i;
-                }
+    void sweep(const edge<T> &e, const T *du, const T *dv, const int *co, int fu, int fv){
+        const T &w = e.w;
+        if(du[fv] + dv[fu] > 2 * res.max_dist) return; // Halpern bound
+        if(fu == fv) return;
+        int k = 0; // Last constraint on hull
+        T x = 0, y = min(du[co[0]], dv[co[0]] + w), xi, yi;
+        for(int i = 1; i < n; ++i){
+            if(dv[co[k]] < dv[co[i]]){ // b_i greater for current value (guaranteed to have lower a_i < a_k because of ordering)
+                xi = (dv[co[k]] - du[co[i]] + w)/2;
+                yi = xi + du[co[i]];
+                if(yi < y) y = yi, x = xi; // If new global min, update
+                k = i;
             }
-            yi = min(d[u][co[k]] + w, d[v][co[k]]);
-            if(yi < y) y = yi, x = 1; 
-            if(y < res.max_dist) res.max_dist = y, res.offset = x, res.cen = e; // Set new absolute center
         }
-        // now res is fully set
-        r.assign(n, 0); vis.assign(n, false);
-        for(int i = 0; i < n; ++i){ // set minimum distances to each node from the absolute center by checking shortest distance to either side of central edge
-            r[i] = min(d[res.cen.u][i] + res.offset, d[res.cen.v][i] + res.cen.w - res.offset); 
+        yi = min(du[co[k]] + w, dv[co[k]]);
+        if(yi < y) y = yi, x = w; // Center on v
+        if(y < res.max_dist) res.max_dist = y, res.offset = x, res.cen = e; // Set new absolute center
+    }
+    void build_sparse(){
+        ecc.assign(n, 0);
+        #pragma omp parallel
+        {
+            vector<T> dist(n);
+            vector<int> par(n);
+            #pragma omp for schedule(dynamic)
+            for(int i = 0; i < n; ++i) ecc[i] = dist[dijkstra({{0, i}}, dist.data(), par.data()).back()];
+        }
+        auto lb = [&](const edge<T> &e){ return ecc[e.u] + ecc[e.v] - e.w; }; // 2 * (lower bound on the diameter through e)
+        vector<edge<T>> es = edges;
+        stable_sort(es.begin(), es.end(), [&](const edge<T> &a, const edge<T> &b){ return lb(a) < lb(b); });
+        cd.assign((ll)cap * n, INF); cord.assign((ll)cap * n, 0);
+        who.assign(cap, -1); last.assign(cap, 0); slot.assign(n, -1);
+        int clock = 0;
+        vector<int> todo;
+        for(int a = 0, b; a < sz(es) && lb(es[a]) < 2 * res.max_dist; a = b){
+            b = min(sz(es), a + cap / 2); // every chunk needs at most cap rows
+            ++clock, todo.clear();
+            for(int i = a; i < b; ++i) for(int v : {es[i].u, es[i].v}) if(slot[v] >= 0) last[slot[v]] = clock;
+            for(int i = a; i < b; ++i){
+                for(int v : {es[i].u, es[i].v}){
+                    if(slot[v] >= 0) continue;
+                    int k = min_element(last.begin(), last.end()) - last.begin(); // least recently used slot
+                    if(who[k] >= 0) slot[who[k]] = -1;
+                    who[k] = v, slot[v] = k, last[k] = clock;
+                    todo.pb(k);
+                }
+            }
+            #pragma omp parallel for schedule(dynamic)
+            for(int i = 0; i < sz(todo); ++i){
+                int k = todo[i];
+                vector<int> par(n);
+                vector<int> order = dijkstra({{0, who[k]}}, cd.data() + (ll)k * n, par.data());
+                copy(order.rbegin(), order.rend(), cord.begin() + (ll)k * n); // sorted by decreasing a_i's
+            }
+            for(int i = a; i < b && lb(es[i]) < 2 * res.max_dist; ++i){
+                ll ku = (ll)slot[es[i].u] * n, kv = (ll)slot[es[i].v] * n;
+                sweep(es[i], cd.data() + ku, cd.data() + kv, cord.data() + ku, cord[ku], cord[kv]);
+            }
         }
-        if(abs(res.offset) > eps) calcSPT(res.cen.v); // Calculates SPT if non zero offset
-        if(res.cen.w > res.offset){
-            calcSPT(res.cen.u); // Calculates SPT if zero offset
-            if (res.offset > 0) tree.pb({res.cen.u, res.cen.v});
+    }
+    void build(){
+        res.cen = edges[0], res.max_dist = INF;
+        if(sparse) build_sparse();
+        else{
+            preprocess();
+            for(auto &e : edges){
+                const T *du = d.data() + (ll)e.u * n, *dv = d.data() + (ll)e.v * n;
+                sweep(e, du, dv, ord[e.u].data(), ord[e.u][0], ord[e.v][0]);
+            }
         }
+        // now res is fully set, r[i] = distance from the absolute center to node i is set by calcSPT()
+        calcSPT();
     }
-};
\ No newline at end of file
+};
+}
@@ -18,6 +18,8 @@
         - https://judge.yosupo.jp/submission/68341
 */
 
+namespace algo{
+
 struct SCC{
     int n;
     vector<bool> vis;
@@ -97,4 +99,5 @@ struct SCC{
             }            
         }
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
@@ -21,6 +21,8 @@
         - Compiler has __builtin_clz
 */
 
+namespace algo{
+
 struct LCA{
     const int INF = 1e9 + 7;
     int n, lg, t;
@@ -65,4 +67,5 @@ struct LCA{
         }
         return up[u][0];
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
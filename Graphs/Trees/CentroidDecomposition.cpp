@@ -1,64 +1,163 @@
-/*  Overview: 
-        - Centroid Decomposition. Builds centroid tree connecting centroids of the original tree 
-          and its recursively split components after the centroids are removed  
+/*  Overview:
+        - Centroid Decomposition. Builds centroid tree connecting centroids of the original tree
+          and its recursively split components after the centroids are removed. Also stores, for every
+          node, its centroid ancestors and its distance to each of them in flat SZ x L arrays
     Parts
-        - g[][] = adjacency list of original tree
+        - g[][] = adjacency list of original tree (not copied, must outlive the CD)
         - adj[][] = adjacency list of tree after centroid decomposition
-        - dead[i] = true if i was already used as a centroid during the decomposition (marked as false again afterwards)
+        - dead[i] = true if i was already used as a centroid during the decomposition
         - SZ = # of nodes in the whole tree
-        - _n = # of nodes in the current componenet
+        - L = max # of levels in the centroid tree (floor(log_2(SZ)) + 1)
         - rt = root of centroid tree
+        - lvl[v] = depth of v in the centroid tree (rt has lvl 0)
+        - cpar[v] = parent of v in the centroid tree (-1 for rt)
+        - anc[v * L + k] = centroid ancestor of v at level k (0 <= k <= lvl[v], anc[v * L + lvl[v]] = v)
+        - dist[v * L + k] = distance in the original tree from v to anc[v * L + k]
+        - best[c] = min distance from centroid c to a marked node in its component (INF if none)
+        - cnt/cnt_off = CSR of sorted distances from centroid c to every node of its component
+        - pcnt/pcnt_off = CSR of sorted distances from cpar[c] to every node of c's component
     Methods:
-        - get_size(v, p):   Sets size array for all nodes in the current component. O(CC Size)
-        - get_cen(v, p):    Uses size information to find centroid of current component. O(CC Size)
-        - find(v):          Driver for get_size and get_cen to break a single component into multiple
-                            componenets with centroid removed. O(CC Size)
-        - dfs(v, p):        DFS using find() to recursively find centroids and build CD tree. O(SZ log_2(SZ))
-        - decomp():         Driver for entire decomposition. O(SZ log_2(SZ))
-    Verification: 
+        - decomp():             Iterative decomposition. Components of the same level are independent, so
+                                each level is processed with an OpenMP parallel for (compile with -fopenmp,
+                                otherwise runs serially). O(SZ log_2(SZ))
+        - mark(v):              Marks node v. O(log_2(SZ))
+        - nearest(v):           Distance from v to the nearest marked node (INF if none). O(log_2(SZ))
+        - build_counts():       Builds cnt and pcnt for count_within(). O(SZ log^2_2(SZ))
+        - count_within(v, k):   # of nodes u with dist(u, v) <= k. O(log^2_2(SZ))
+    Verification:
         - https://codeforces.com/contest/716/submission/85067920
         - https://codeforces.com/contest/342/submission/84929339
-        - https://codeforces.com/contest/1303/submission/85247906       */
+        - https://codeforces.com/contest/1303/submission/85247906
+        - mark(), nearest(), count_within(): N/A       */
+namespace algo{
+
 struct CD{
-    int SZ, _n, rt = -1;
+    const int INF = 1e9 + 7;
+    int SZ, L, rt = -1;
+    const vector<vector<int>> &g;
     vector<bool> dead;
-    vector<int> size;
-    vector<vector<int>> adj, g;
-    CD(int SZ, vector<vector<int>> &g): SZ(SZ), g(g){
-        size.assign(SZ, 0);
-        dead.assign(SZ, 0);
+    vector<int> size, bpar, lvl, cpar, anc, dist, best;
+    vector<int> cnt, cnt_off, pcnt, pcnt_off;
+    vector<vector<int>> adj;
+    CD(int SZ, const vector<vector<int>> &g): SZ(SZ), g(g){
+        L = 1;
+        while((1 << L) <= SZ) ++L;
+        size.assign(SZ, 0); bpar.assign(SZ, -1);
+        lvl.assign(SZ, 0); cpar.assign(SZ, -1);
+        anc.assign((ll)SZ * L, -1); dist.assign((ll)SZ * L, 0);
+        best.assign(SZ, INF);
+        dead.assign(SZ, false);
         adj.assign(SZ, vector<int>());
-
     }
-    void get_size(int v, int p){
-        size[v] = 1;
-        for(auto i : g[v]){
-            if(dead[i] || i == p) continue;
-            get_size(i, v);
-            size[v] += size[i];
+    // BFS over the component containing v, order[] is filled parents first. O(CC Size)
+    void bfs(int v, vector<int> &order){
+        order.clear(); order.pb(v); bpar[v] = -1;
+        for(int i = 0; i < sz(order); ++i){
+            int u = order[i];
+            for(auto w : g[u]){
+                if(dead[w] || w == bpar[u]) continue;
+                bpar[w] = u;
+                order.pb(w);
+            }
         }
     }
-    int get_cen(int v, int p){
-        for(auto i : g[v]){
-            if(i == p || size[i] <= _n/2 || dead[i]) continue;
-            return get_cen(i, v);
+    // Returns centroid of the component whose BFS order is given. O(CC Size)
+    int get_cen(const vector<int> &order){
+        int _n = sz(order);
+        for(int i = _n - 1; i >= 0; --i){
+            int u = order[i], mx = 0;
+            size[u] = 1;
+            for(auto w : g[u]){
+                if(dead[w] || w == bpar[u]) continue;
+                size[u] += size[w];
+                ckmax(mx, size[w]);
+            }
+            if(mx <= _n/2 && _n - size[u] <= _n/2) return u;
         }
-        return v;
-    }
-    int find(int v){
-        get_size(v, -1);
-        _n = size[v];
-        return get_cen(v, -1);
-    }
-    void dfs(int v, int cc){
-        int cen = find(v);
-        dead[cen] = true;
-        for(auto i : g[cen]) if(!dead[i]) dfs(i, cen);
-        if(cc >= 0) adj[cc].pb(cen), adj[cen].pb(cc);
-        else rt = cen;
+        return order[0];
     }
     void decomp(){
         dead.assign(SZ, false);
-        dfs(0, -1);
+        vector<pair<int, int>> cur = {{0, -1}}, nxt; // {node in component, parent centroid}
+        for(int k = 0; !cur.empty(); ++k){
+            vector<int> cens(sz(cur));
+            #pragma omp parallel
+            {
+                vector<int> order;
+                #pragma omp for schedule(dynamic)
+                for(int i = 0; i < sz(cur); ++i){
+                    bfs(cur[i].f, order);
+                    int cen = get_cen(order);
+                    bfs(cen, order);
+                    for(auto u : order){ // order is by non-decreasing distance from cen
+                        int d = (u == cen ? 0 : dist[(ll)bpar[u] * L + k] + 1);
+                        anc[(ll)u * L + k] = cen, dist[(ll)u * L + k] = d;
+                    }
+                    lvl[cen] = k, cpar[cen] = cur[i].s, cens[i] = cen;
+                }
+            }
+            nxt.clear();
+            for(int i = 0; i < sz(cur); ++i){
+                int cen = cens[i];
+                dead[cen] = true;
+                if(cur[i].s >= 0) adj[cur[i].s].pb(cen), adj[cen].pb(cur[i].s);
+                else rt = cen;
+            }
+            for(auto cen : cens){
+                for(auto w : g[cen]) if(!dead[w]) nxt.pb({w, cen});
+            }
+            swap(cur, nxt);
+        }
+    }
+    void mark(int v){
+        for(int k = 0; k <= lvl[v]; ++k){
+            int c = anc[(ll)v * L + k];
+            ckmin(best[c], dist[(ll)v * L + k]);
+        }
+    }
+    int nearest(int v){
+        int res = INF;
+        for(int k = 0; k <= lvl[v]; ++k){
+            int c = anc[(ll)v * L + k];
+            if(best[c] < INF) ckmin(res, best[c] + dist[(ll)v * L + k]);
+        }
+        return res;
+    }
+    void build_counts(){
+        cnt_off.assign(SZ + 1, 0); pcnt_off.assign(SZ + 1, 0);
+        for(int v = 0; v < SZ; ++v){
+            for(int k = 0; k <= lvl[v]; ++k){
+                int c = anc[(ll)v * L + k];
+                ++cnt_off[c + 1];
+                if(k > 0) ++pcnt_off[c + 1];
+            }
+        }
+        for(int c = 0; c < SZ; ++c) cnt_off[c + 1] += cnt_off[c], pcnt_off[c + 1] += pcnt_off[c];
+        cnt.assign(cnt_off[SZ], 0); pcnt.assign(pcnt_off[SZ], 0);
+        vector<int> pos(cnt_off.begin(), cnt_off.end() - 1), ppos(pcnt_off.begin(), pcnt_off.end() - 1);
+        for(int v = 0; v < SZ; ++v){
+            for(int k = 0; k <= lvl[v]; ++k){
+                int c = anc[(ll)v * L + k];
+                cnt[pos[c]++] = dist[(ll)v * L + k];
+                if(k > 0) pcnt[ppos[c]++] = dist[(ll)v * L + k - 1];
+            }
+        }
+        for(int c = 0; c < SZ; ++c){
+            sort(cnt.begin() + cnt_off[c], cnt.begin() + cnt_off[c + 1]);
+            sort(pcnt.begin() + pcnt_off[c], pcnt.begin() + pcnt_off[c + 1]);
+        }
+    }
+    ll count_within(int v, int k){
+        ll res = 0;
+        for(int j = 0; j <= lvl[v]; ++j){
+            int c = anc[(ll)v * L + j], d = dist[(ll)v * L + j];
+            res += upper_bound(cnt.begin() + cnt_off[c], cnt.begin() + cnt_off[c + 1], k - d) - (cnt.begin() + cnt_off[c]);
+            if(j > 0){ // remove nodes already counted through the parent centroid
+                int pd = dist[(ll)v * L + j - 1];
+                res -= upper_bound(pcnt.begin() + pcnt_off[c], pcnt.begin() + pcnt_off[c + 1], k - pd) - (pcnt.begin() + pcnt_off[c]);
+            }
+        }
+        return res;
     }
-};
\ No newline at end of file
+};
+}
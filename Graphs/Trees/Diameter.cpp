@@ -1,35 +1,89 @@
-#include <bits/stdc++.h>
+/* Call get_diameter(adj) on adjacency list of unweighted tree to get a diameter with endpoints u, v and length = dist.
+   For weighted trees build a CSR<T> from an edge list {u, v, w} (w >= 0) and call get_diameter(g). path.nodes holds
+   the whole diameter from u to v. get_eccentricities(g) returns the eccentricity of every node, the radius and the
+   1 or 2 centers in O(n) using ecc(x) = max(dist(x, u), dist(x, v)) for diameter endpoints u, v.
+   Everything is iterative, so it is safe on deep trees (paths with n = 10^6). */
+namespace algo{
 
-using namespace std;
-
-template<typename T, typename U> bool ckmax(T &a, U b){ return b > a ? a = b, true : false; }
-
-/* Call get_diameter(adj) on adjacency list of unweighted tree to get a diameter with endpoints u, v and length = dist*/
 namespace Diameter {
+    template<typename T> struct CSR{
+        int n;
+        vector<int> off, to;
+        vector<T> w;
+        CSR(int n, const vector<tuple<int, int, T>> &edges): n(n), off(n + 1, 0), to(2 * edges.size()), w(2 * edges.size()){
+            for(auto &[u, v, _] : edges) ++off[u + 1], ++off[v + 1];
+            for(int i = 0; i < n; ++i) off[i + 1] += off[i];
+            vector<int> pos(off.begin(), off.end() - 1);
+            for(auto &[u, v, c] : edges){
+                to[pos[u]] = v, w[pos[u]++] = c;
+                to[pos[v]] = u, w[pos[v]++] = c;
+            }
+        }
+        CSR(const vector<vector<int>> &adj): n(adj.size()), off(adj.size() + 1, 0){
+            for(int i = 0; i < n; ++i) off[i + 1] = off[i] + adj[i].size();
+            for(auto &l : adj) to.insert(to.end(), l.begin(), l.end());
+            w.assign(to.size(), 1);
+        }
+    };
+
     namespace detail{
-        // dist, vertex
-        pair<int, int> find_furthest(int v, int p, int cur_dist, const vector<vector<int>> &adj){
-            pair<int, int> best = {cur_dist, v};
-            for(auto i : adj[v]){
-                if(i == p) continue;
-                ckmax(best, find_furthest(i, v, cur_dist + 1, adj));
+        // fills dist[] and par[] for the tree rooted at src, returns furthest vertex
+        template<typename T> int find_furthest(int src, const CSR<T> &g, vector<T> &dist, vector<int> &par){
+            dist.assign(g.n, 0); par.assign(g.n, -1);
+            vector<int> stk = {src};
+            int best = src;
+            while(!stk.empty()){
+                int v = stk.back(); stk.pop_back();
+                if(dist[v] > dist[best]) best = v;
+                for(int e = g.off[v]; e < g.off[v + 1]; ++e){
+                    int i = g.to[e];
+                    if(i == par[v]) continue;
+                    par[i] = v, dist[i] = dist[v] + g.w[e];
+                    stk.push_back(i);
+                }
             }
             return best;
         }
     }
 
-    struct path{
-        int u, v, dist;
+    template<typename T> struct path{
+        int u, v; T dist;
+        vector<int> nodes;
     };
 
-    path get_diameter(const vector<vector<int>> &adj){
-        auto [_, u] = detail::find_furthest(0, -1, 0, adj);
-        auto [dist, v] = detail::find_furthest(u, -1, 0, adj);
+    template<typename T> path<T> get_diameter(const CSR<T> &g){
+        vector<T> dist; vector<int> par;
+        int u = detail::find_furthest(0, g, dist, par);
+        int v = detail::find_furthest(u, g, dist, par);
+        vector<int> nodes;
+        for(int i = v; i != -1; i = par[i]) nodes.push_back(i);
+        reverse(nodes.begin(), nodes.end());
 
-        return {.u = u, .v = v, .dist = dist};
+        return {.u = u, .v = v, .dist = dist[v], .nodes = nodes};
     }
-};
 
-int main(){
-    return 0;
+    inline path<int> get_diameter(const vector<vector<int>> &adj){
+        return get_diameter(CSR<int>(adj));
+    }
+
+    template<typename T> struct eccentricities{
+        vector<T> ecc;
+        T radius;
+        vector<int> centers;
+    };
+
+    template<typename T> eccentricities<T> get_eccentricities(const CSR<T> &g){
+        vector<T> du, dv; vector<int> par;
+        int u = detail::find_furthest(0, g, du, par);
+        int v = detail::find_furthest(u, g, du, par);
+        detail::find_furthest(v, g, dv, par);
+        vector<T> ecc(g.n);
+        for(int i = 0; i < g.n; ++i) ecc[i] = max(du[i], dv[i]);
+        T radius = *min_element(ecc.begin(), ecc.end());
+        vector<int> centers;
+        for(int i = 0; i < g.n; ++i) if(ecc[i] == radius) centers.push_back(i);
+
+        return {.ecc = ecc, .radius = radius, .centers = centers};
+    }
+};
 }
@@ -0,0 +1,118 @@
+/*  Overview:
+        - Heavy-Light Decomposition. Splits a rooted tree into heavy chains so that any root-to-node path
+          crosses O(log n) chains, then lays the nodes out in heavy-first DFS order so every heavy chain
+          (and every subtree) is a contiguous range of a segment tree.
+    Parts
+        - T = Value type stored in the segment tree
+        - ST = Segment tree type (SegmentTree<T> or LazySegmentTree<T, S>). Must provide
+               ST(vector<T> &a, T id, int sz), qry(l, r), cmb(x, y) and id. path_update/subtree_update
+               need a range upd(l, r, x), point_update needs upd(u, x)
+        - n = number of nodes in the tree
+        - vals_in_edges = true if values live on edges (value of edge (v, par[v]) is stored at v)
+        - par[v] = parent of v (root is its own parent)
+        - dep[v] = depth of v
+        - size[v] = size of subtree rooted at v
+        - heavy[v] = child of v with the largest subtree (-1 for leaves)
+        - head[v] = topmost node of the heavy chain containing v
+        - pos[v] = index of v in the segment tree base array
+        - st = segment tree over the base array (st[pos[v]] = value of v)
+    Methods:
+        - build(a, id):             Builds st with identity id where a[v] is the initial value of node v. O(n)
+        - lca(u, v):                Least common ancestor of u and v. O(log n)
+        - path_query(u, v):         cmb of all values on the path u -> v. O(log^2 n)
+        - path_update(u, v, x):     Range update by x on every value on the path u -> v. O(log^2 n)
+        - point_update(v, x):       Sets value of v to x (calls st.upd(pos[v], x)). O(log n)
+        - subtree_query(v):         cmb of all values in the subtree of v. O(log n)
+        - subtree_update(v, x):     Range update by x on every value in the subtree of v. O(log n)
+    Verification:
+        - N/A
+    Assumptions:
+        - cmb() is commutative (path segments are combined in arbitrary direction)
+        - Decomposition is iterative so it is safe on deep trees (paths with n = 10^6)
+*/
+
+namespace algo{
+
+template<typename T, typename ST> struct HLD{
+    int n, root;
+    bool vals_in_edges;
+    vector<int> par, dep, size, heavy, head, pos;
+    ST st;
+
+    HLD(int n, const vector<vector<int>> &adj, int root = 0, bool vals_in_edges = false): n(n), root(root), vals_in_edges(vals_in_edges), st(T(), 0){
+        par.assign(n, root); dep.assign(n, 0); size.assign(n, 1);
+        heavy.assign(n, -1); head.assign(n, root); pos.assign(n, 0);
+        vector<int> order; order.reserve(n);
+        order.pb(root);
+        for(int i = 0; i < sz(order); ++i){ // BFS order, parents before children
+            int v = order[i];
+            for(auto u : adj[v]){
+                if(u == par[v]) continue;
+                par[u] = v, dep[u] = dep[v] + 1;
+                order.pb(u);
+            }
+        }
+        for(int i = n - 1; i > 0; --i){
+            int v = order[i], p = par[v];
+            size[p] += size[v];
+            if(heavy[p] == -1 || size[v] > size[heavy[p]]) heavy[p] = v;
+        }
+        int t = 0;
+        vector<int> stk = {root};
+        while(!stk.empty()){ // heavy child is pushed last so its chain continues at pos[v] + 1
+            int v = stk.back(); stk.pop_back();
+            pos[v] = t++;
+            for(auto u : adj[v]){
+                if(u == par[v] || u == heavy[v]) continue;
+                head[u] = u;
+                stk.pb(u);
+            }
+            if(heavy[v] != -1){
+                head[heavy[v]] = head[v];
+                stk.pb(heavy[v]);
+            }
+        }
+    }
+
+    void build(const vector<T> &a, T id){
+        vector<T> base(n);
+        for(int v = 0; v < n; ++v) base[pos[v]] = a[v];
+        st = ST(base, id, n);
+    }
+
+    int lca(int u, int v){
+        for(; head[u] != head[v]; u = par[head[u]]){
+            if(dep[head[u]] < dep[head[v]]) swap(u, v);
+        }
+        return dep[u] < dep[v] ? u : v;
+    }
+
+    // calls op(l, r) on the O(log n) contiguous ranges of pos[] covering the path u -> v
+    template<typename Op> void process_path(int u, int v, Op op){
+        for(; head[u] != head[v]; u = par[head[u]]){
+            if(dep[head[u]] < dep[head[v]]) swap(u, v);
+            op(pos[head[u]], pos[u]);
+        }
+        if(dep[u] > dep[v]) swap(u, v);
+        if(pos[u] + vals_in_edges <= pos[v]) op(pos[u] + vals_in_edges, pos[v]);
+    }
+
+    T path_query(int u, int v){
+        T res = st.id;
+        process_path(u, v, [&](int l, int r){ res = st.cmb(res, st.qry(l, r)); });
+        return res;
+    }
+
+    template<typename U> void path_update(int u, int v, U x){
+        process_path(u, v, [&](int l, int r){ st.upd(l, r, x); });
+    }
+
+    template<typename U> void point_update(int v, U x){ st.upd(pos[v], x); }
+
+    T subtree_query(int v){ return st.qry(pos[v] + vals_in_edges, pos[v] + size[v] - 1); }
+
+    template<typename U> void subtree_update(int v, U x){
+        if(size[v] > vals_in_edges) st.upd(pos[v] + vals_in_edges, pos[v] + size[v] - 1, x);
+    }
+};
+}
@@ -0,0 +1,70 @@
+/*  Overview:
+        - Rerooting DP. Computes dp[v] = (tree DP of the whole tree rooted at v) for every v in two linear
+          passes instead of n separate traversals
+    Parts
+        - M = Monoid type of the DP
+        - W = Edge weight type
+        - adj[i][j] = jth connection of ith node {node, edge weight}
+        - id = Identity element of merge()
+        - merge(a, b):          Monoid operation used to combine the contributions of a node's neighbours
+        - lift(x, c, p, w):     Contribution of the subtree rooted at c (with dp value x) to its parent p
+                                through the edge of weight w
+        - fin(acc, v):          dp value of v given the merged contributions acc of all its children
+        - down[v] = dp of the subtree of v in the tree rooted at node 0
+        - up[v] = dp of the parent of v in the tree rooted at v (undefined for node 0)
+    Methods:
+        - solve(adj, id, merge, lift, fin): Returns dp[] for every root. O(n) calls to merge/lift/fin
+    Verification:
+        - N/A
+    Assumptions:
+        - merge() is associative and commutative
+        - Iterative (BFS order), safe on deep trees
+    Example (sum of distances to all other nodes, M = pair<ll, ll> {sum of dist, # nodes}):
+        - merge = {a.f + b.f, a.s + b.s}, lift(x, c, p, w) = {x.f + x.s * w, x.s}, fin(acc, v) = {acc.f, acc.s + 1}
+*/
+
+namespace algo{
+
+template<typename M, typename W> struct Rerooting{
+    int n;
+    vector<int> order, par;
+    vector<W> parw;
+    vector<M> down, up, dp;
+    template<typename Merge, typename Lift, typename Fin>
+    vector<M> solve(const vector<vector<pair<int, W>>> &adj, M id, Merge merge, Lift lift, Fin fin){
+        n = sz(adj);
+        order.assign(1, 0); order.reserve(n);
+        par.assign(n, -1); parw.assign(n, W());
+        for(int i = 0; i < sz(order); ++i){
+            int v = order[i];
+            for(auto &e : adj[v]){
+                if(e.f == par[v]) continue;
+                par[e.f] = v, parw[e.f] = e.s;
+                order.pb(e.f);
+            }
+        }
+        down.assign(n, id); up.assign(n, id); dp.assign(n, id);
+        vector<M> acc(n, id);
+        for(int i = n - 1; i >= 0; --i){ // pass 1: leaves to root
+            int v = order[i];
+            down[v] = fin(acc[v], v);
+            if(par[v] >= 0) acc[par[v]] = merge(acc[par[v]], lift(down[v], v, par[v], parw[v]));
+        }
+        vector<M> pre, suf, lc;
+        vector<int> ch;
+        for(auto v : order){ // pass 2: root to leaves, excluding each child with prefix/suffix merges
+            M top = (par[v] >= 0 ? lift(up[v], par[v], v, parw[v]) : id);
+            ch.clear();
+            for(auto &e : adj[v]) if(e.f != par[v]) ch.pb(e.f);
+            int k = sz(ch);
+            pre.assign(k + 1, id); suf.assign(k + 1, id); lc.resize(k);
+            for(int j = 0; j < k; ++j) lc[j] = lift(down[ch[j]], ch[j], v, parw[ch[j]]);
+            for(int j = 0; j < k; ++j) pre[j + 1] = merge(pre[j], lc[j]);
+            for(int j = k - 1; j >= 0; --j) suf[j] = merge(lc[j], suf[j + 1]);
+            dp[v] = fin(merge(top, pre[k]), v);
+            for(int j = 0; j < k; ++j) up[ch[j]] = fin(merge(top, merge(pre[j], suf[j + 1])), v);
+        }
+        return dp;
+    }
+};
+}
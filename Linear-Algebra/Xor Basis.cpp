@@ -15,6 +15,8 @@
     Verification: 
         - insert(), find(): https://atcoder.jp/contests/agc045/submissions/14138170
         - normalize():      N/A        */
+namespace algo{
+
 template<int SZ, typename T> struct XorBasis{
     int sz;
     T basis[SZ];
@@ -52,4 +54,5 @@ template<int SZ, typename T> struct XorBasis{
             }
         }
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
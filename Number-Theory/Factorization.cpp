@@ -1,66 +1,375 @@
-#include "bits/stdc++.h"
+namespace algo{
 
-using namespace std;
+namespace Factorization{
+    typedef unsigned long long ull;
 
-typedef long double ld;
-typedef long long ll;
+    /*  Overview:
+	    - Linear sieve. Every composite is crossed out exactly once (by its smallest prime factor), O(MAX_NUM)
+	Parts:
+	    - T = type of the packed spf array. Only composites store their spf (<= sqrt(MAX_NUM)), primes store 0, so
+	      uint16_t covers every int MAX_NUM (2 bytes per entry instead of 4)
+	    - spf[x] = smallest prime factor of x if x is composite, 0 otherwise
+	    - primes = every prime <= MAX_NUM in increasing order
+	    - phi, mu, d, sigma = Euler's totient, Mobius, # of divisors and sum of divisors, filled in the same linear
+	      pass when the constructor is called with mult = true (empty otherwise)
+	Methods:
+	    - get_spf(x), is_prime(x): O(1)
+	    - get_prime_factors(x, out): Writes the {prime, exponent} pairs of x in increasing order to out, returns the #
+				of pairs (at most MAXP = 9 for x < 2^31). O(log x), no allocations
+	    - get_factors(x, out): Writes every divisor of x to out (unsorted, 1 first), returns the # of divisors (at most
+				MAXD = 1600 for x < 2^31). O(# divisors), no allocations
+	    - get_prime_factors(x), get_factors(x): Same, returned as vectors
+	    - factor_many(xs, st, pfs): CSR batch, the pairs of xs[i] are pfs[st[i], st[i + 1]). O(\sum log xs[i])
+    */
+    template<typename T = uint16_t> struct FactorizationSieve{
+	static constexpr int MAXP = 9, MAXD = 1600;
+	int MAX_NUM;
+	vector<T> spf;
+	vector<int> primes, phi, d;
+	vector<int8_t> mu;
+	vector<ll> sigma;
+	FactorizationSieve(int MAX_NUM, bool mult = false): MAX_NUM(MAX_NUM), spf(max(MAX_NUM + 1, 2), 0){
+	    assert((ld)numeric_limits<T>::max() >= sqrtl(MAX_NUM));
+	    vector<uint8_t> e; // e[x] = exponent of spf(x) in x
+	    vector<ll> sp;     // sp[x] = 1 + p + ... + p^e[x] for p = spf(x)
+	    if(mult){
+		int n = max(MAX_NUM + 1, 2);
+		phi.assign(n, 1), d.assign(n, 1), mu.assign(n, 1), sigma.assign(n, 1), e.assign(n, 0), sp.assign(n, 1);
+		phi[0] = d[0] = mu[0] = sigma[0] = 0;
+	    }
+	    for(int i = 2; i <= MAX_NUM; ++i){
+		if(spf[i] == 0){
+		    primes.pb(i);
+		    if(mult) phi[i] = i - 1, mu[i] = -1, d[i] = 2, e[i] = 1, sp[i] = sigma[i] = i + 1;
+		}
+		int si = get_spf(i), lim = min(si, MAX_NUM / i);
+		for(int j = 0; j < sz(primes) && primes[j] <= lim; ++j){
+		    int p = primes[j], x = i * p;
+		    spf[x] = p;
+		    if(!mult) continue;
+		    if(p < si){ // p does not divide i
+			phi[x] = phi[i] * (p - 1), mu[x] = -mu[i], d[x] = d[i] * 2;
+			e[x] = 1, sp[x] = p + 1, sigma[x] = sigma[i] * (p + 1);
+		    }
+		    else{
+			phi[x] = phi[i] * p, mu[x] = 0, d[x] = d[i] / (e[i] + 1) * (e[i] + 2);
+			e[x] = e[i] + 1, sp[x] = sp[i] * p + 1, sigma[x] = sigma[i] / sp[i] * sp[x];
+		    }
+		}
+	    }
+	}
 
-#define sz(x) (int)(x).size()
-#define pb push_back
-#define mp make_pair
-#define f first
-#define s second
+	inline int get_spf(int x){ return spf[x] ? spf[x] : x; }
+	inline bool is_prime(int x){ return x >= 2 && spf[x] == 0; }
 
-template<typename T, typename U> bool ckmin(T &a, U b){ return b < a ? a = b, true : false; }
-template<typename T, typename U> bool ckmax(T &a, U b){ return b > a ? a = b, true : false; }
+	int get_prime_factors(int x, pair<int, int> *out){
+	    int k = 0;
+	    while(x > 1){
+		int p = get_spf(x), c = 0;
+		for(; x % p == 0; x /= p) ++c;
+		out[k++] = {p, c};
+	    }
+	    return k;
+	}
 
-namespace Factorization{
-    struct FactorizationSieve{
-	vector<int> s;
-	FactorizationSieve(int MAX_NUM){
-	    s.assign(MAX_NUM + 5, 1);
-	    s[0] = 0;
-	    for(int i = 2; i <= MAX_NUM; ++i){
-		if(s[i] != 1){ // not prime --> skip
-		    continue;
-		}
-		for(int j = i; j <= MAX_NUM; j += i){
-		    if(s[j] == 1) s[j] = i;
+	int get_factors(int x, int *out){
+	    pair<int, int> pfs[MAXP];
+	    int k = get_prime_factors(x, pfs), cnt = 1;
+	    out[0] = 1;
+	    for(int i = 0; i < k; ++i){
+		int cur = cnt, mul = 1;
+		for(int j = 0; j < pfs[i].s; ++j){
+		    mul *= pfs[i].f;
+		    for(int t = 0; t < cur; ++t) out[cnt++] = out[t] * mul;
 		}
 	    }
+	    return cnt;
 	}
-	
+
 	vector<pair<int, int>> get_prime_factors(int x){
-	    map<int, int> pfs;
-	    while(x != 1){
-		++pfs[s[x]];
-		x /= s[x];
-	    }
-	    return vector<pair<int, int>>(pfs.begin(), pfs.end());
+	    pair<int, int> buf[MAXP];
+	    return vector<pair<int, int>>(buf, buf + get_prime_factors(x, buf));
 	}
 
 	vector<int> get_factors(int x){
-	    auto pfs = get_prime_factors(x);
-	    vector<int> ret;
-	    gen(0, pfs, ret, 1);
-	    return ret;
+	    int buf[MAXD];
+	    return vector<int>(buf, buf + get_factors(x, buf));
 	}
 
-	private:
-	    void gen(int idx, const vector<pair<int, int>> &pfs, vector<int> &ret, int cur){
-		if(idx == sz(pfs)){
-		    ret.push_back(cur);
-		    return;
+	void factor_many(const vector<int> &xs, vector<int> &st, vector<pair<int, int>> &pfs){
+	    st.assign(sz(xs) + 1, 0);
+	    for(int i = 0; i < sz(xs); ++i){
+		if(sz(pfs) < st[i] + MAXP) pfs.resize(max(2 * sz(pfs), st[i] + MAXP));
+		st[i + 1] = st[i] + get_prime_factors(xs[i], pfs.data() + st[i]);
+	    }
+	    pfs.resize(st.back());
+	}
+    };
+
+    /*  Overview:
+	    - Segmented sieve of Eratosthenes for primes in [lo, hi], hi up to ~10^12
+	Parts:
+	    - Wheel 30: byte b holds the 8 numbers 30b + RES[k] coprime to 30 (bit k), so 30 numbers take 1 byte
+	    - SEG = segment size in bytes (L1 sized), a segment covers 30 * SEG numbers
+	    - base = primes in [7, sqrt(hi)], from FactorizationSieve
+	    - Every base prime p = 30a + RES[c] only visits its multiples p * q with q coprime to 30. Going from q to the
+	      next such q moves a * gap[w] + add[c][w] bytes and the bit to clear is clr[c][w] (w = class of q), so
+	      there are no divisions in the inner loop and the position carries over from segment to segment
+	Methods:
+	    - run(b0, b1, on_seg):  Sieves bytes [b0, b1) in order, calls on_seg(first byte, bits, # bytes) per segment
+	    - count(lo, hi):        # of primes in [lo, hi]. Independent chunks of segments are sieved in parallel
+				    (compile with -fopenmp). ~O(n log log n)
+	    - for_each(lo, hi, report): Calls report(p) for every prime p in [lo, hi] in increasing order
+	Verification:
+	    - N/A
+    */
+    struct SegmentedSieve{
+	static constexpr int SEG = 1 << 15, CHUNK = 64; // CHUNK = # of segments per parallel task
+	static constexpr int RES[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+	int bit[30], gap[8], add[8][8];
+	uint8_t clr[8][8], ge[31], le[30]; // ge[r] / le[r] = bits of the numbers >= r / <= r in a byte
+	ull hi;
+	vector<ull> base;
+
+	SegmentedSieve(ull hi): hi(hi){
+	    fill(bit, bit + 30, -1);
+	    for(int k = 0; k < 8; ++k) bit[RES[k]] = k;
+	    for(int w = 0; w < 8; ++w) gap[w] = (w < 7 ? RES[w + 1] : 31) - RES[w];
+	    for(int c = 0; c < 8; ++c){
+		for(int w = 0; w < 8; ++w){
+		    add[c][w] = RES[c] * (RES[w] + gap[w]) / 30 - RES[c] * RES[w] / 30;
+		    clr[c][w] = ~(1 << bit[RES[c] * RES[w] % 30]);
 		}
-		int mul = 1;
-		for(int i = 0; i <= pfs[idx].s; ++i){
-		    gen(idx + 1, pfs, ret, cur * mul);
-		    mul *= pfs[idx].f;
+	    }
+	    for(int r = 30; r >= 0; --r){
+		ge[r] = 0;
+		for(int k = 0; k < 8; ++k) if(RES[k] >= r) ge[r] |= 1 << k;
+		if(r < 30) le[r] = ~ge[r + 1];
+	    }
+	    ull r = sqrtl(hi);
+	    while(r * r > hi) --r;
+	    while((r + 1) * (r + 1) <= hi) ++r;
+	    FactorizationSieve<> fs(max<ull>(r, 2));
+	    for(int p : fs.primes) if(p >= 7) base.pb(p);
+	}
+
+	template<typename F> void run(ull b0, ull b1, F on_seg){
+	    int k = sz(base);
+	    vector<ull> nb(k);
+	    vector<uint8_t> w(k), c(k);
+	    for(int i = 0; i < k; ++i){
+		ull p = base[i], q = max(p, (b0 * 30 + p - 1) / p); // first multiple in a byte >= b0, skipping below p^2
+		while(bit[q % 30] < 0) ++q;
+		nb[i] = p * q / 30, w[i] = bit[q % 30], c[i] = bit[p % 30];
+	    }
+	    vector<uint8_t> seg(SEG);
+	    for(ull lo = b0; lo < b1; lo += SEG){
+		int len = min<ull>(SEG, b1 - lo);
+		ull end = lo + len;
+		memset(seg.data(), 0xFF, len);
+		if(lo == 0) seg[0] &= ~1; // 1 is not prime
+		for(int i = 0; i < k && base[i] * base[i] < end * 30; ++i){
+		    ull j = nb[i], a = base[i] / 30;
+		    int q = w[i], ci = c[i];
+		    for(; j < end; q = (q + 1) & 7){
+			seg[j - lo] &= clr[ci][q];
+			j += a * gap[q] + add[ci][q];
+		    }
+		    nb[i] = j, w[i] = q;
 		}
+		on_seg(lo, seg.data(), len);
 	    }
+	}
+
+	inline void clip(ull lo, ull hi, ull b, uint8_t *bits, int len){ // drops the numbers outside of [lo, hi]
+	    if(lo / 30 >= b && lo / 30 < b + len) bits[lo / 30 - b] &= ge[lo % 30];
+	    if(hi / 30 >= b && hi / 30 < b + len) bits[hi / 30 - b] &= le[hi % 30];
+	}
+
+	ull count(ull lo, ull hi){
+	    assert(hi <= this->hi);
+	    ull res = 0;
+	    for(ull p : {2, 3, 5}) res += (lo <= p && p <= hi);
+	    if(lo > hi) return 0;
+	    ull b0 = lo / 30, b1 = hi / 30 + 1, step = (ull)SEG * CHUNK;
+	    ll tasks = (b1 - b0 + step - 1) / step;
+	    #pragma omp parallel for schedule(dynamic) reduction(+:res)
+	    for(ll t = 0; t < tasks; ++t){
+		run(b0 + t * step, min(b1, b0 + (t + 1) * step), [&](ull b, uint8_t *bits, int len){
+		    clip(lo, hi, b, bits, len);
+		    int i = 0;
+		    for(ull x; i + 8 <= len; i += 8){
+			memcpy(&x, bits + i, 8);
+			res += __builtin_popcountll(x);
+		    }
+		    for(; i < len; ++i) res += __builtin_popcount(bits[i]);
+		});
+	    }
+	    return res;
+	}
+
+	template<typename F> void for_each(ull lo, ull hi, F report){
+	    assert(hi <= this->hi);
+	    for(ull p : {2, 3, 5}) if(lo <= p && p <= hi) report(p);
+	    if(lo > hi) return;
+	    run(lo / 30, hi / 30 + 1, [&](ull b, uint8_t *bits, int len){
+		clip(lo, hi, b, bits, len);
+		for(int i = 0; i < len; ++i){
+		    for(int m = bits[i]; m; m &= m - 1) report((b + i) * 30 + RES[__builtin_ctz(m)]);
+		}
+	    });
+	}
+    };
+
+    /*  Overview:
+	    - Montgomery multiplication modulo an odd 64 bit n. Values are kept in Montgomery form (a * 2^64 mod n), so a
+	      modular product is 2 128 bit multiplications and no division
+	Methods:
+	    - to(a), from(a):   Converts into / out of Montgomery form
+	    - mul(a, b):        a * b (both in Montgomery form), result in [0, n)
+	    - pow(a, e):        a^e (a in Montgomery form). O(log e)
+    */
+    struct Montgomery{
+	typedef __uint128_t u128;
+	ull n, inv, r2; // inv = n^-1 mod 2^64, r2 = 2^128 mod n
+	Montgomery(ull n): n(n), inv(n), r2(-(u128)n % n){
+	    for(int i = 0; i < 5; ++i) inv *= 2 - n * inv; // Newton iteration, doubles the # of correct bits
+	}
+	inline ull reduce(u128 x) const { // x * 2^-64 mod n, x < n * 2^64
+	    ull m = ((u128)((ull)x * inv) * n) >> 64, hi = x >> 64;
+	    return hi >= m ? hi - m : hi + n - m;
+	}
+	inline ull mul(ull a, ull b) const { return reduce((u128)a * b); }
+	inline ull to(ull a) const { return mul(a % n, r2); }
+	inline ull from(ull a) const { return reduce(a); }
+	ull pow(ull a, ull e) const {
+	    ull res = to(1);
+	    for(; e; e >>= 1, a = mul(a, a)) if(e & 1) res = mul(res, a);
+	    return res;
+	}
     };
 
-    vector<pair<int, int>> get_prime_factors(int x){
+    /*  Overview:
+	    - Factorization of 64 bit integers. Deterministic Miller-Rabin + Pollard-Brent rho, both on Montgomery
+	Methods:
+	    - is_prime(n):      Miller-Rabin with the 7 bases that are exact for every n < 2^64. O(7 log n) products
+	    - pollard_brent(n): A non-trivial factor of composite n. Brent's cycle detection, the |x - y| are multiplied
+				together and gcd'd once per M steps (backtracking if the batch overshoots). ~O(n^(1/4))
+	    - factor(n, out):   Writes the {prime, exponent} pairs of n in increasing order to out (at most MAXP64 = 15 for
+				n < 2^64), returns the # of pairs (0 for n <= 1). Small primes by trial division, the rest
+				iteratively with an explicit stack. No allocations
+	    - factor(n):        Same, returned as a vector
+	    - divisors(pfs, k, out): Writes every divisor of the number with the k prime factors pfs to out (unsorted,
+				1 first), returns the # of divisors. out needs room for d(n) (at most MAXD64 = 184320 for
+				n < 2^64, reached by 18401055938125660800)
+	Verification:
+	    - N/A
+    */
+    constexpr int MAXP64 = 15, MAXD64 = 184320;
+
+    inline bool is_prime(ull n){
+	if(n < 2) return false;
+	for(ull p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) if(n % p == 0) return n == p;
+	if(n < 37 * 37) return true;
+	Montgomery M(n);
+	ull d = n - 1, one = M.to(1), mone = M.to(n - 1);
+	int r = __builtin_ctzll(d);
+	d >>= r;
+	for(ull a : {2, 325, 9375, 28178, 450775, 9780504, 1795265022}){
+	    if(a % n == 0) continue;
+	    ull x = M.pow(M.to(a), d);
+	    if(x == one || x == mone) continue;
+	    int i = 1;
+	    for(; i < r && x != mone; ++i) x = M.mul(x, x);
+	    if(x != mone) return false;
+	}
+	return true;
+    }
+
+    inline ull pollard_brent(ull n){
+	if(n % 2 == 0) return 2;
+	const int M = 128;
+	Montgomery mg(n);
+	for(ull c0 = 1; ; ++c0){
+	    ull c = mg.to(c0), x = 0, y = mg.to(2), ys = 0, q = mg.to(1), g = 1;
+	    auto next = [&](ull v){
+		ull r = mg.mul(v, v) + c;
+		return (r >= n || r < c) ? r - n : r;
+	    };
+	    for(ull r = 1; g == 1; r <<= 1){
+		x = y;
+		for(ull i = 0; i < r; ++i) y = next(y);
+		for(ull k = 0; k < r && g == 1; k += M){
+		    ys = y;
+		    for(ull i = 0; i < M && i < r - k; ++i){
+			y = next(y);
+			q = mg.mul(q, x > y ? x - y : y - x);
+		    }
+		    g = gcd(q, n);
+		}
+	    }
+	    if(g == n){ // the batch overshot, redo it one step at a time
+		do{
+		    ys = next(ys);
+		    g = gcd(x > ys ? x - ys : ys - x, n);
+		} while(g == 1);
+	    }
+	    if(g != n) return g;
+	}
+    }
+
+    inline int factor(ull n, pair<ull, int> *out){
+	if(n <= 1) return 0;
+	int k = 0;
+	ull ps[64];
+	int top = 0;
+	for(ull p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47}){
+	    if(n % p) continue;
+	    out[k] = {p, 0};
+	    for(; n % p == 0; n /= p) ++out[k].s;
+	    ++k;
+	}
+	int small = k;
+	if(n > 1) ps[top++] = n;
+	ull found[64];
+	int cnt = 0;
+	while(top){
+	    ull m = ps[--top];
+	    if(is_prime(m)){
+		found[cnt++] = m;
+		continue;
+	    }
+	    ull d = pollard_brent(m);
+	    ps[top++] = d, ps[top++] = m / d;
+	}
+	sort(found, found + cnt);
+	for(int i = 0; i < cnt; ++i){
+	    if(k > small && out[k - 1].f == found[i]) ++out[k - 1].s;
+	    else out[k++] = {found[i], 1};
+	}
+	return k;
+    }
+
+    inline vector<pair<ull, int>> factor(ull n){
+	pair<ull, int> buf[MAXP64];
+	return vector<pair<ull, int>>(buf, buf + factor(n, buf));
+    }
+
+    inline int divisors(const pair<ull, int> *pfs, int k, ull *out){
+	int cnt = 1;
+	out[0] = 1;
+	for(int i = 0; i < k; ++i){
+	    int cur = cnt;
+	    ull mul = 1;
+	    for(int j = 0; j < pfs[i].s; ++j){
+		mul *= pfs[i].f;
+		for(int t = 0; t < cur; ++t) out[cnt++] = out[t] * mul;
+	    }
+	}
+	return cnt;
+    }
+
+    inline vector<pair<int, int>> get_prime_factors(int x){
 	map<int, int> pfs;
 	ll cur = 2;
 	while(x > 1 && cur * cur <= x){
@@ -74,7 +383,7 @@ namespace Factorization{
 	return vector<pair<int, int>>(pfs.begin(), pfs.end());
     }
 
-    vector<int> get_factors(int x){
+    inline vector<int> get_factors(int x){
 	vector<int> facs;
 	ll cur = 2;
 	while(cur * cur <= x){
@@ -88,10 +397,4 @@ namespace Factorization{
 	return facs;
     }
 }
-
-int main(){
-    ios_base::sync_with_stdio(false);
-    cin.tie(NULL);
-    
-    return 0;
 }
@@ -0,0 +1,186 @@
+/*  Overview:
+        - Modular integers. ModInt<MOD> (compile time modulus, Montgomery form) and DynamicModInt<ID> (runtime modulus,
+          Barrett reduction). Both behave like an integer type, so they can be used directly as T in the SOS
+          convolutions, rolling hashes, matrices, etc.
+    Parts
+        - ModInt<MOD>: v = a * 2^32 mod MOD. NINV = -MOD^-1 mod 2^32, R2 = 2^64 mod MOD (computed at compile time).
+          A product is 2 32x32 -> 64 bit multiplications and a shift, no division
+        - DynamicModInt<ID>: v = a mod MOD. IM = ceil(2^64 / MOD), set by set_mod(). ID separates independent moduli
+        - Combinatorics<M>: fact[i] = i!, ifact[i] = (i!)^-1, inv[i] = i^-1 for i <= n
+        - mul_batch(a, b, out, n): out[i] = a[i] * b[i] for ModInt arrays, 8 lanes at a time with AVX2 (compile with
+          -mavx2 or -march=native, scalar otherwise)
+    Methods:
+        - +, -, *, / (and the compound versions), unary -, ==, !=, <<, >>
+        - val():        Value in [0, MOD)
+        - pow(e):       Iterative binary exponentiation. O(log e)
+        - inv():        Inverse by Fermat (ModInt, MOD must be prime) or extended Euclid (DynamicModInt, gcd(a, MOD) = 1)
+        - C(n, k), P(n, k): Binomial coefficient / # of k-permutations. O(1) after the O(n) precomputation
+    Verification:
+        - N/A
+    Assumptions:
+        - ModInt: MOD odd, MOD < 2^31. DynamicModInt: 1 <= MOD < 2^31
+*/
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace algo{
+
+template<uint32_t MOD> struct ModInt{
+    static_assert(MOD % 2 == 1 && MOD < (1u << 31), "MOD must be odd and < 2^31");
+    static constexpr uint32_t get_ninv(){
+        uint32_t inv = MOD;
+        for(int i = 0; i < 4; ++i) inv *= 2 - MOD * inv; // Newton iteration, doubles the # of correct bits
+        return -inv;
+    }
+    static constexpr uint32_t NINV = get_ninv(), R2 = -(uint64_t)MOD % MOD;
+    uint32_t v;
+
+    static inline uint32_t reduce(uint64_t x){ // x * 2^-32 mod MOD, x < MOD * 2^32
+        uint32_t t = (x + (uint64_t)((uint32_t)x * NINV) * MOD) >> 32;
+        return t >= MOD ? t - MOD : t;
+    }
+    ModInt(): v(0) {}
+    ModInt(ll x){
+        x %= (ll)MOD;
+        v = reduce((uint64_t)(x < 0 ? x + MOD : x) * R2);
+    }
+    static constexpr uint32_t mod(){ return MOD; }
+    uint32_t val() const { return reduce(v); }
+
+    ModInt &operator+=(const ModInt &o){
+        if((v += o.v) >= MOD) v -= MOD;
+        return *this;
+    }
+    ModInt &operator-=(const ModInt &o){
+        if((v += MOD - o.v) >= MOD) v -= MOD;
+        return *this;
+    }
+    ModInt &operator*=(const ModInt &o){
+        v = reduce((uint64_t)v * o.v);
+        return *this;
+    }
+    ModInt &operator/=(const ModInt &o){ return *this *= o.inv(); }
+    ModInt operator-() const { return ModInt() - *this; }
+    ModInt pow(ll e) const {
+        ModInt res = 1, a = *this;
+        for(; e; e >>= 1, a *= a) if(e & 1) res *= a;
+        return res;
+    }
+    ModInt inv() const { return pow(MOD - 2); }
+
+    friend ModInt operator+(ModInt a, const ModInt &b){ return a += b; }
+    friend ModInt operator-(ModInt a, const ModInt &b){ return a -= b; }
+    friend ModInt operator*(ModInt a, const ModInt &b){ return a *= b; }
+    friend ModInt operator/(ModInt a, const ModInt &b){ return a /= b; }
+    friend bool operator==(const ModInt &a, const ModInt &b){ return a.v == b.v; }
+    friend bool operator!=(const ModInt &a, const ModInt &b){ return a.v != b.v; }
+    friend ostream &operator<<(ostream &os, const ModInt &a){ return os << a.val(); }
+    friend istream &operator>>(istream &is, ModInt &a){
+        ll x;
+        is >> x;
+        a = ModInt(x);
+        return is;
+    }
+};
+
+template<int ID = 0> struct DynamicModInt{
+    static inline uint32_t MOD = 998244353;
+    static inline uint64_t IM = ~0ULL / 998244353 + 1;
+    static void set_mod(uint32_t m){
+        assert(1 <= m && m < (1u << 31));
+        MOD = m, IM = ~0ULL / m + 1;
+    }
+    uint32_t v;
+
+    static inline uint32_t reduce(uint64_t x){ // x mod MOD, x < MOD^2
+        uint64_t q = ((__uint128_t)x * IM) >> 64;
+        uint32_t r = x - q * MOD;
+        return r >= MOD ? r + MOD : r; // q is at most 1 too large
+    }
+    DynamicModInt(): v(0) {}
+    DynamicModInt(ll x){
+        x %= (ll)MOD;
+        v = (x < 0 ? x + MOD : x);
+    }
+    static uint32_t mod(){ return MOD; }
+    uint32_t val() const { return v; }
+
+    DynamicModInt &operator+=(const DynamicModInt &o){
+        if((v += o.v) >= MOD) v -= MOD;
+        return *this;
+    }
+    DynamicModInt &operator-=(const DynamicModInt &o){
+        if((v += MOD - o.v) >= MOD) v -= MOD;
+        return *this;
+    }
+    DynamicModInt &operator*=(const DynamicModInt &o){
+        v = reduce((uint64_t)v * o.v);
+        return *this;
+    }
+    DynamicModInt &operator/=(const DynamicModInt &o){ return *this *= o.inv(); }
+    DynamicModInt operator-() const { return DynamicModInt() - *this; }
+    DynamicModInt pow(ll e) const {
+        DynamicModInt res = 1, a = *this;
+        for(; e; e >>= 1, a *= a) if(e & 1) res *= a;
+        return res;
+    }
+    DynamicModInt inv() const {
+        ll a = v, b = MOD, x = 1, y = 0;
+        while(b){
+            ll q = a / b;
+            swap(a -= q * b, b);
+            swap(x -= q * y, y);
+        }
+        assert(a == 1);
+        return DynamicModInt(x);
+    }
+
+    friend DynamicModInt operator+(DynamicModInt a, const DynamicModInt &b){ return a += b; }
+    friend DynamicModInt operator-(DynamicModInt a, const DynamicModInt &b){ return a -= b; }
+    friend DynamicModInt operator*(DynamicModInt a, const DynamicModInt &b){ return a *= b; }
+    friend DynamicModInt operator/(DynamicModInt a, const DynamicModInt &b){ return a /= b; }
+    friend bool operator==(const DynamicModInt &a, const DynamicModInt &b){ return a.v == b.v; }
+    friend bool operator!=(const DynamicModInt &a, const DynamicModInt &b){ return a.v != b.v; }
+    friend ostream &operator<<(ostream &os, const DynamicModInt &a){ return os << a.val(); }
+    friend istream &operator>>(istream &is, DynamicModInt &a){
+        ll x;
+        is >> x;
+        a = DynamicModInt(x);
+        return is;
+    }
+};
+
+template<typename M> struct Combinatorics{
+    vector<M> fact, ifact, inv;
+    Combinatorics(int n): fact(n + 1), ifact(n + 1), inv(n + 1){
+        fact[0] = 1;
+        for(int i = 1; i <= n; ++i) fact[i] = fact[i - 1] * M(i);
+        ifact[n] = fact[n].inv();
+        for(int i = n; i > 0; --i) ifact[i - 1] = ifact[i] * M(i);
+        for(int i = 1; i <= n; ++i) inv[i] = ifact[i] * fact[i - 1];
+    }
+    M C(int n, int k){ return (k < 0 || k > n) ? M() : fact[n] * ifact[k] * ifact[n - k]; }
+    M P(int n, int k){ return (k < 0 || k > n) ? M() : fact[n] * ifact[n - k]; }
+};
+
+template<uint32_t MOD> void mul_batch(const ModInt<MOD> *a, const ModInt<MOD> *b, ModInt<MOD> *out, int n){
+    int i = 0;
+#ifdef __AVX2__
+    const __m256i mod = _mm256_set1_epi32(MOD), ninv = _mm256_set1_epi32(ModInt<MOD>::NINV);
+    auto redc = [&](__m256i x){ // Montgomery reduction of the 4 64 bit lanes, result in the low 32 bits
+        __m256i m = _mm256_mul_epu32(_mm256_mul_epu32(x, ninv), mod);
+        return _mm256_srli_epi64(_mm256_add_epi64(x, m), 32);
+    };
+    for(; i + 8 <= n; i += 8){
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + i)), y = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i ev = redc(_mm256_mul_epu32(x, y));
+        __m256i od = redc(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32)));
+        __m256i t = _mm256_blend_epi32(ev, _mm256_slli_epi64(od, 32), 0b10101010);
+        t = _mm256_min_epu32(t, _mm256_sub_epi32(t, mod)); // t < 2 * MOD
+        _mm256_storeu_si256((__m256i *)(out + i), t);
+    }
+#endif
+    for(; i < n; ++i) out[i] = a[i] * b[i];
+}
+}
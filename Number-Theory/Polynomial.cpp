@@ -0,0 +1,289 @@
+/*  Overview:
+        - NTT based polynomial library over ModInt<MOD> (from "Modular Integer.cpp", include it first)
+    Parts
+        - M = ModInt<MOD> with MOD < 2^30 prime and 2^k | MOD - 1 for every transform size 2^k (e.g. 998244353)
+        - Polynomials are vector<M>, coefficient i at index i
+        - NTT<M>::rt[k + j] = w_{2k}^j for every power of 2 k (j < k), rt3[k + j] = w_{2k}^{3j}, irt / irt3 = inverses.
+          Filled once per modulus up to the largest size used
+        - NTT<M>::dif(a, n): In place forward transform, natural order in, bit reversed order out (no permutation pass).
+          Radix 4 (2 levels per pass, 3 twiddle products per 4 elements) with one radix 2 pass when log2(n) is odd
+        - NTT<M>::dit(a, n): Exact inverse of dif (bit reversed in, natural out, scaled by 1/n)
+        - All arithmetic is in Montgomery form (ModInt), no division in the butterflies. Values inside a transform are
+          only reduced to [0, 2 MOD) (MOD < 2^30), the final pass brings them back to [0, MOD)
+    Methods (n = # of coefficients of the result):
+        - multiply(a, b, limit):    a * b, truncated to the first limit coefficients if limit >= 0. O(n log n)
+        - poly_inv(a, n):           a^-1 mod x^n (a[0] != 0). Newton. O(n log n)
+        - poly_divmod(a, b):        {q, r} with a = b * q + r, deg r < deg b (b.back() != 0). O(n log n)
+        - poly_log(a, n):           log(a) mod x^n (a[0] = 1). O(n log n)
+        - poly_exp(a, n):           exp(a) mod x^n (a[0] = 0). Newton. O(n log n)
+        - poly_sqrt(a, n):          sqrt(a) mod x^n (a[0] = 1). Newton. O(n log n)
+        - evaluate(a, xs):          {a(x) for x in xs}. Subproduct tree, Horner below 32 points. O(n log^2 n)
+        - multiply_any(a, b, mod):  a * b mod any mod < 2^31 (values in [0, mod)). 3 NTTs modulo 167772161, 469762049
+                                    and 754974721 + CRT (Garner), exact while n * mod^2 < ~5.8 * 10^25. O(n log n)
+    Verification:
+        - N/A
+*/
+
+namespace algo{
+
+template<typename M> struct NTT{
+    static inline vector<M> rt = {0, 1}, rt3 = {0, 1}, irt = {0, 1}, irt3 = {0, 1};
+    static M root(){ // smallest primitive root of MOD
+        static M g = M();
+        if(g != M()) return g;
+        uint32_t p = M::mod() - 1;
+        vector<uint32_t> fs;
+        for(uint32_t d = 2; (uint64_t)d * d <= p; ++d){
+            if(p % d) continue;
+            fs.pb(d);
+            while(p % d == 0) p /= d;
+        }
+        if(p > 1) fs.pb(p);
+        for(uint32_t c = 2; ; ++c){
+            bool ok = true;
+            for(auto q : fs) if(M(c).pow((M::mod() - 1) / q) == M(1)) ok = false;
+            if(ok) return g = M(c);
+        }
+    }
+    static void ensure(int n){
+        for(int k = sz(rt); k < n; k <<= 1){
+            assert((M::mod() - 1) % (2 * k) == 0);
+            M z = root().pow((M::mod() - 1) / (2 * k)), iz = z.inv();
+            for(auto v : {&rt, &rt3, &irt, &irt3}) v->resize(2 * k);
+            rt[k] = irt[k] = rt3[k] = irt3[k] = 1;
+            for(int j = k + 1; j < 2 * k; ++j){
+                rt[j] = rt[j - 1] * z, irt[j] = irt[j - 1] * iz;
+                rt3[j] = rt[j] * rt[j] * rt[j], irt3[j] = irt[j] * irt[j] * irt[j];
+            }
+        }
+    }
+    // Butterflies work on the raw Montgomery values, lazily reduced to [0, 2 MOD) (needs MOD < 2^30)
+    static constexpr uint32_t MOD = M::mod(), MOD2 = 2 * MOD;
+    static_assert(MOD < (1u << 30), "NTT needs MOD < 2^30");
+    static inline uint32_t red2(uint32_t x){ return x >= MOD2 ? x - MOD2 : x; }
+    static inline uint32_t mulr(uint32_t a, uint32_t b){ // a * b * 2^-32 in [0, 2 MOD), a * b < 2^32 * MOD
+        uint64_t x = (uint64_t)a * b;
+        return (x + (uint64_t)((uint32_t)x * M::NINV) * MOD) >> 32;
+    }
+    static void dif(M *A, int n){
+        ensure(n);
+        uint32_t *a = &A[0].v;
+        int blk = n;
+        if(__builtin_ctz(n) & 1){
+            int len = n / 2;
+            for(int j = 0; j < len; ++j){
+                uint32_t u = a[j], v = a[j + len];
+                a[j] = red2(u + v), a[j + len] = mulr(u - v + MOD2, rt[len + j].v);
+            }
+            blk = len;
+        }
+        for(; blk >= 4; blk >>= 2){
+            int m = blk / 4;
+            uint32_t I = rt[3].v; // w_4
+            const uint32_t *w1 = &rt[2 * m].v, *w2 = &rt[m].v, *w3 = &rt3[2 * m].v;
+            for(uint32_t *p = a; p != a + n; p += blk){
+                for(int j = 0; j < m; ++j){
+                    uint32_t a0 = p[j], a1 = p[j + m], a2 = p[j + 2 * m], a3 = p[j + 3 * m];
+                    uint32_t s02 = red2(a0 + a2), d02 = red2(a0 - a2 + MOD2), s13 = red2(a1 + a3), d13 = mulr(a1 - a3 + MOD2, I);
+                    p[j] = red2(s02 + s13);
+                    p[j + m] = mulr(s02 - s13 + MOD2, w2[j]);
+                    p[j + 2 * m] = mulr(d02 + d13, w1[j]);
+                    p[j + 3 * m] = mulr(d02 - d13 + MOD2, w3[j]);
+                }
+            }
+        }
+        for(int i = 0; i < n; ++i) a[i] -= (a[i] >= MOD ? MOD : 0);
+    }
+    static void dit(M *A, int n){
+        ensure(n);
+        uint32_t *a = &A[0].v;
+        int top = (__builtin_ctz(n) & 1) ? n / 2 : n, blk = 4;
+        for(; blk <= top; blk <<= 2){
+            int m = blk / 4;
+            uint32_t iI = irt[3].v;
+            const uint32_t *w1 = &irt[2 * m].v, *w2 = &irt[m].v, *w3 = &irt3[2 * m].v;
+            for(uint32_t *p = a; p != a + n; p += blk){
+                for(int j = 0; j < m; ++j){
+                    uint32_t a0 = p[j], t1 = mulr(p[j + m], w2[j]), t2 = mulr(p[j + 2 * m], w1[j]), t3 = mulr(p[j + 3 * m], w3[j]);
+                    uint32_t s = red2(a0 + t1), d = red2(a0 - t1 + MOD2), s23 = red2(t2 + t3), d23 = mulr(t2 - t3 + MOD2, iI);
+                    p[j] = red2(s + s23), p[j + 2 * m] = red2(s - s23 + MOD2);
+                    p[j + m] = red2(d + d23), p[j + 3 * m] = red2(d - d23 + MOD2);
+                }
+            }
+        }
+        if(top != n){
+            int len = n / 2;
+            for(int j = 0; j < len; ++j){
+                uint32_t u = a[j], v = mulr(a[j + len], irt[len + j].v);
+                a[j] = red2(u + v), a[j + len] = red2(u - v + MOD2);
+            }
+        }
+        uint32_t inv_n = M(n).inv().v;
+        for(int i = 0; i < n; ++i){
+            a[i] = mulr(a[i], inv_n);
+            a[i] -= (a[i] >= MOD ? MOD : 0);
+        }
+    }
+};
+
+template<typename M> vector<M> multiply(vector<M> a, vector<M> b, int limit = -1){
+    if(limit >= 0){
+        if(sz(a) > limit) a.resize(limit);
+        if(sz(b) > limit) b.resize(limit);
+    }
+    if(a.empty() || b.empty()) return {};
+    int n = sz(a) + sz(b) - 1;
+    vector<M> res;
+    if(min(sz(a), sz(b)) <= 32){
+        res.assign(n, M());
+        for(int i = 0; i < sz(a); ++i) for(int j = 0; j < sz(b); ++j) res[i + j] += a[i] * b[j];
+    }
+    else{
+        int L = 1;
+        while(L < n) L <<= 1;
+        a.resize(L), b.resize(L);
+        NTT<M>::dif(a.data(), L); NTT<M>::dif(b.data(), L);
+        for(int i = 0; i < L; ++i) a[i] *= b[i];
+        NTT<M>::dit(a.data(), L);
+        a.resize(n);
+        res = move(a);
+    }
+    if(limit >= 0 && sz(res) > limit) res.resize(limit);
+    return res;
+}
+
+template<typename M> vector<M> poly_inv(const vector<M> &a, int n){
+    assert(!a.empty() && a[0] != M());
+    vector<M> b = {a[0].inv()}, fa, fb;
+    for(int k = 1; k < n; k <<= 1){ // b = b * (2 - a * b) mod x^{2k}
+        int L = 4 * k;
+        fa.assign(L, M()), fb.assign(L, M());
+        copy_n(a.begin(), min(sz(a), 2 * k), fa.begin());
+        copy(b.begin(), b.end(), fb.begin());
+        NTT<M>::dif(fa.data(), L); NTT<M>::dif(fb.data(), L);
+        for(int i = 0; i < L; ++i) fa[i] = fb[i] * (M(2) - fa[i] * fb[i]);
+        NTT<M>::dit(fa.data(), L);
+        b.assign(fa.begin(), fa.begin() + 2 * k);
+    }
+    b.resize(n);
+    return b;
+}
+
+template<typename M> pair<vector<M>, vector<M>> poly_divmod(const vector<M> &a, const vector<M> &b){
+    int n = sz(a), m = sz(b);
+    assert(m > 0 && b.back() != M());
+    if(n < m) return {{}, a};
+    vector<M> ra(a.rbegin(), a.rend()), rb(b.rbegin(), b.rend());
+    auto q = multiply(ra, poly_inv(rb, n - m + 1), n - m + 1);
+    reverse(q.begin(), q.end());
+    auto bq = multiply(b, q, m - 1);
+    vector<M> r(m - 1);
+    for(int i = 0; i < m - 1; ++i) r[i] = a[i] - bq[i];
+    return {q, r};
+}
+
+template<typename M> vector<M> inverses(int n){ // inv[i] = i^-1 for 1 <= i < n
+    vector<M> inv(max(n, 2));
+    inv[1] = 1;
+    for(int i = 2; i < n; ++i) inv[i] = -M(M::mod() / i) * inv[M::mod() % i];
+    return inv;
+}
+
+template<typename M> vector<M> poly_log(const vector<M> &a, int n){
+    assert(!a.empty() && a[0] == M(1));
+    vector<M> d(max(min(sz(a), n) - 1, 0));
+    for(int i = 1; i <= sz(d); ++i) d[i - 1] = a[i] * M(i);
+    auto q = multiply(d, poly_inv(a, n), n - 1);
+    auto inv = inverses<M>(n);
+    vector<M> res(n);
+    for(int i = 1; i < n && i - 1 < sz(q); ++i) res[i] = q[i - 1] * inv[i];
+    return res;
+}
+
+template<typename M> vector<M> poly_exp(const vector<M> &a, int n){
+    assert(a.empty() || a[0] == M());
+    vector<M> g = {1};
+    for(int k = 1; k < n; k <<= 1){ // g = g * (1 - log(g) + a) mod x^{2k}
+        auto l = poly_log(g, 2 * k);
+        for(int i = 0; i < 2 * k; ++i) l[i] = (i < sz(a) ? a[i] : M()) - l[i];
+        l[0] += M(1);
+        g = multiply(g, l, 2 * k);
+    }
+    g.resize(n);
+    return g;
+}
+
+template<typename M> vector<M> poly_sqrt(const vector<M> &a, int n){
+    assert(!a.empty() && a[0] == M(1));
+    vector<M> s = {1};
+    M inv2 = M(2).inv();
+    for(int k = 1; k < n; k <<= 1){ // s = (s + a / s) / 2 mod x^{2k}
+        auto t = multiply(vector<M>(a.begin(), a.begin() + min(sz(a), 2 * k)), poly_inv(s, 2 * k), 2 * k);
+        s.resize(2 * k);
+        for(int i = 0; i < 2 * k; ++i) s[i] = (s[i] + (i < sz(t) ? t[i] : M())) * inv2;
+    }
+    s.resize(n);
+    return s;
+}
+
+template<typename M> vector<M> evaluate(const vector<M> &a, const vector<M> &xs){
+    int k = sz(xs);
+    vector<M> res(k);
+    if(k == 0) return res;
+    vector<vector<M>> tr(4 * k);
+    auto build = [&](auto &&self, int v, int l, int r) -> void {
+        if(r - l <= 32){
+            tr[v] = {1};
+            for(int i = l; i < r; ++i){ // multiply by (x - xs[i])
+                tr[v].pb(M());
+                for(int j = sz(tr[v]) - 1; j > 0; --j) tr[v][j] = tr[v][j - 1] - tr[v][j] * xs[i];
+                tr[v][0] = -tr[v][0] * xs[i];
+            }
+            return;
+        }
+        int mid = (l + r) / 2;
+        self(self, 2 * v, l, mid); self(self, 2 * v + 1, mid, r);
+        tr[v] = multiply(tr[2 * v], tr[2 * v + 1]);
+    };
+    auto down = [&](auto &&self, int v, int l, int r, vector<M> rem) -> void {
+        if(sz(rem) >= sz(tr[v])) rem = poly_divmod(rem, tr[v]).s;
+        if(r - l <= 32){
+            for(int i = l; i < r; ++i){
+                M y;
+                for(int j = sz(rem) - 1; j >= 0; --j) y = y * xs[i] + rem[j];
+                res[i] = y;
+            }
+            return;
+        }
+        int mid = (l + r) / 2;
+        self(self, 2 * v, l, mid, rem); self(self, 2 * v + 1, mid, r, rem);
+    };
+    build(build, 1, 0, k);
+    down(down, 1, 0, k, a);
+    return res;
+}
+
+inline vector<ll> multiply_any(const vector<ll> &a, const vector<ll> &b, uint32_t mod){
+    const uint32_t P1 = 167772161, P2 = 469762049, P3 = 754974721;
+    typedef ModInt<P1> M1;
+    typedef ModInt<P2> M2;
+    typedef ModInt<P3> M3;
+    auto conv = [&](auto id){
+        typedef decltype(id) MI;
+        return multiply(vector<MI>(a.begin(), a.end()), vector<MI>(b.begin(), b.end()));
+    };
+    auto r1 = conv(M1());
+    auto r2 = conv(M2());
+    auto r3 = conv(M3());
+    M2 i1 = M2(P1).inv();
+    M3 i12 = (M3(P1) * M3(P2)).inv();
+    uint64_t p12 = (uint64_t)P1 * P2 % mod;
+    vector<ll> res(sz(r1));
+    for(int i = 0; i < sz(r1); ++i){ // Garner: x = v1 + v2 * P1 + v3 * P1 * P2
+        uint64_t v1 = r1[i].val(), v2 = ((M2(v1) - r2[i]) * -i1).val();
+        uint64_t v3 = ((r3[i] - M3(v1) - M3(v2) * M3(P1)) * i12).val();
+        res[i] = (v1 + v2 * P1 % mod + v3 * p12) % mod;
+    }
+    return res;
+}
+}
@@ -0,0 +1,111 @@
+/*  Overview:
+        - Aho-Corasick automaton (multi-pattern matching) with a flat dense goto table
+    Parts
+        - al = alphabet size, off = offset (usually 'a'). Elements must be in [off, off + al)
+        - cid[x - off] = compressed id of element x (only elements that occur in some pattern get an id, every other
+          element maps to the extra column K - 1, which always leads back to the root)
+        - K = # of columns of the goto table (# of distinct pattern elements + 1)
+        - go[v * K + c] = DFA transition from node v by compressed element c (complete after build())
+        - link[v] = suffix (failure) link of node v
+        - olink[v] = closest node on the suffix link chain of v (excluding v) that ends a pattern (-1 if none)
+        - head[v] = first pattern ending at node v (-1 if none), nxt[i] = next pattern ending at the same node as pattern i
+        - len[i] = length of pattern i
+        - child = trie edges before build() (hashed, freed by build())
+        - cnt[v] = # of patterns ending at node v or any node on its suffix link chain
+        - cur, pos = current node and # of elements fed so far (streaming state)
+    Methods:
+        - add(pat):             Adds a pattern to the trie, returns its id. O(|pat|)
+        - build():              Computes link, olink, cnt and fills every missing transition with BFS. O(nodes * K)
+        - feed(data, n, report): Consumes n more elements, calls report(start, id) for every occurrence of pattern id
+                                starting at absolute offset start (follows olink so only real matches are visited).
+                                O(n + matches)
+        - feed(chunk, report):  Same as above for a string/vector chunk
+        - count(chunk):         Consumes the chunk and returns the # of matches inside it without enumerating them. O(n)
+        - reset():              Restarts the stream at the root, offset 0
+    Verification:
+        - N/A
+    Assumptions:
+        - All patterns are added before build(), patterns are non-empty
+        - Large alphabets are handled by compressing to the elements that occur in the patterns, so the table is
+          nodes * (# distinct pattern elements + 1) ints regardless of al
+*/
+
+namespace algo{
+
+struct AhoCorasick{
+    int al, off, K = 0, cur = 0, nodes = 1;
+    ll pos = 0;
+    vector<int> cid, go, link, olink, head, nxt, len;
+    vector<ll> cnt;
+    unordered_map<ll, int> child; // trie edges before build(), child[v * al + element] = child of v
+
+    AhoCorasick(int al, int off): al(al), off(off), cid(al, -1), head(1, -1) {}
+
+    template<typename T> int add(const T &pat){
+        int v = 0;
+        for(auto x : pat){
+            int c = x - off;
+            if(cid[c] == -1) cid[c] = K++;
+            auto it = child.find((ll)v * al + cid[c]);
+            if(it == child.end()){
+                it = child.insert({(ll)v * al + cid[c], nodes++}).f;
+                head.pb(-1);
+            }
+            v = it->s;
+        }
+        int id = sz(len);
+        len.pb(sz(pat)); nxt.pb(head[v]);
+        head[v] = id;
+        return id;
+    }
+
+    void build(){
+        int n = nodes;
+        ++K; // column K - 1 is for elements outside of every pattern
+        for(auto &c : cid) if(c == -1) c = K - 1;
+        go.assign((ll)n * K, 0); link.assign(n, 0); olink.assign(n, -1); cnt.assign(n, 0);
+        for(auto &e : child) go[e.f / al * K + e.f % al] = e.s;
+        vector<int> q = {0};
+        for(int i = 0; i < sz(q); ++i){ // BFS, link[v] is final before v's children are visited
+            int v = q[i];
+            cnt[v] = cnt[link[v]];
+            for(int j = head[v]; j != -1; j = nxt[j]) ++cnt[v];
+            for(int c = 0; c < K; ++c){
+                int &u = go[(ll)v * K + c];
+                int fail = (v == 0 ? 0 : go[(ll)link[v] * K + c]);
+                if(u == 0){ // missing edge, reuse the failure transition
+                    u = fail;
+                    continue;
+                }
+                link[u] = fail;
+                olink[u] = (head[fail] != -1 ? fail : olink[fail]);
+                q.pb(u);
+            }
+        }
+        child = unordered_map<ll, int>();
+    }
+
+    void reset(){ cur = 0, pos = 0; }
+
+    template<typename S, typename F> void feed(const S *data, int n, F report){
+        for(int i = 0; i < n; ++i, ++pos){
+            cur = go[(ll)cur * K + cid[data[i] - off]];
+            for(int v = (head[cur] != -1 ? cur : olink[cur]); v != -1; v = olink[v]){
+                for(int j = head[v]; j != -1; j = nxt[j]) report(pos - len[j] + 1, j);
+            }
+        }
+    }
+
+    template<typename C, typename F> void feed(const C &chunk, F report){ feed(chunk.data(), sz(chunk), report); }
+
+    template<typename C> ll count(const C &chunk){
+        ll res = 0;
+        for(auto x : chunk){
+            cur = go[(ll)cur * K + cid[x - off]];
+            res += cnt[cur];
+        }
+        pos += sz(chunk);
+        return res;
+    }
+};
+}
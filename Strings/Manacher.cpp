@@ -0,0 +1,39 @@
+/*  Overview: 
+        - Manacher's algorithm. Odd and even palindromes in one pass over the 2n - 1 centers of the virtual string
+          s[0] # s[1] # ... # s[n - 1] (the separators are never materialized)
+    Parts:
+        - T = Argument type (usually string)
+        - pal[c] = length of the longest palindrome centered at c. Even c is centered at s[c/2] (odd length), odd c is
+          centered between s[c/2] and s[c/2 + 1] (even length, possibly 0)
+    Methods:
+        - manacher(str):            Returns pal[] (2n - 1 ints). O(n)
+        - is_pal(pal, l, r):        true iff s[l, r] is a palindrome. O(1)
+        - longest_palindrome(pal):  {start, length} of a longest palindromic substring. O(n)
+    Verification: 
+        - N/A      */
+
+namespace algo{
+
+template<typename T> vector<int> manacher(const T &str){
+    int n = sz(str), m = max(2 * n - 1, 0);
+    vector<int> d(m); // d[i] = radius in the virtual string
+    for(int i = 0, l = 0, r = -1; i < m; ++i){
+        int k = (i > r) ? 0 : min(d[l + r - i], r - i);
+        while(i - k - 1 >= 0 && i + k + 1 < m && (((i - k - 1) & 1) || str[(i - k - 1) >> 1] == str[(i + k + 1) >> 1])) ++k;
+        d[i] = k;
+        if(i + k > r) l = i - k, r = i + k;
+    }
+    for(int i = 0; i < m; ++i) d[i] = (i & 1) ? ((d[i] + 1) >> 1) << 1 : ((d[i] >> 1) << 1) + 1;
+    return d;
+}
+
+inline bool is_pal(const vector<int> &pal, int l, int r){ return pal[l + r] >= r - l + 1; }
+
+inline pair<int, int> longest_palindrome(const vector<int> &pal){
+    pair<int, int> res = {0, 0};
+    for(int c = 0; c < sz(pal); ++c){
+        if(pal[c] > res.s) res = {(c + 1 - pal[c]) >> 1, pal[c]};
+    }
+    return res;
+}
+}
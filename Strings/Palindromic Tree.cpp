@@ -0,0 +1,57 @@
+/*  Overview: 
+        - Palindromic tree (eertree). One node per distinct palindromic substring, built online by appending elements
+    Parts
+        - S = single element type (usually char)
+        - Node 0 = imaginary root (len -1), node 1 = empty string root (len 0), every other node is a distinct palindrome
+        - len[v] = length of palindrome v, link[v] = longest proper palindromic suffix of v
+        - head[v], sib[v], ch[v] = children of v as a singly linked list (first child, next sibling, element on the edge
+          into v), so every node is 5 ints + 1 element no matter the alphabet size
+        - cnt[v] = # of prefixes whose longest palindromic suffix is v
+        - last = longest palindromic suffix of the current string
+    Methods:
+        - add(c):       Appends c, returns true iff it created a new distinct palindrome. O(1) amortized (* out degree)
+        - distinct():   # of distinct non-empty palindromic substrings. O(1)
+        - occurrences(): occ[v] = # of occurrences of palindrome v in the current string. O(# nodes)
+    Verification: 
+        - N/A       */
+
+namespace algo{
+
+template<typename S> struct Eertree{
+    int last = 1;
+    vector<int> len, link, head, sib, cnt;
+    vector<S> ch, str;
+    Eertree(int reserve = 0): len{-1, 0}, link{0, 0}, head{-1, -1}, sib{-1, -1}, cnt{0, 0}, ch(2){
+        for(auto v : {&len, &link, &head, &sib, &cnt}) v->reserve(reserve + 2);
+        ch.reserve(reserve + 2); str.reserve(reserve);
+    }
+    int get(int v, S c){
+        for(int u = head[v]; u != -1; u = sib[u]) if(ch[u] == c) return u;
+        return -1;
+    }
+    int get_link(int v, int i){
+        while(i - 1 - len[v] < 0 || !(str[i - 1 - len[v]] == str[i])) v = link[v];
+        return v;
+    }
+    bool add(S c){
+        str.pb(c);
+        int i = sz(str) - 1, cur = get_link(last, i), u = get(cur, c);
+        if(u != -1){
+            ++cnt[last = u];
+            return false;
+        }
+        u = sz(len);
+        int lk = (len[cur] == -1) ? 1 : get(get_link(link[cur], i), c);
+        len.pb(len[cur] + 2); link.pb(lk); ch.pb(c); cnt.pb(1);
+        head.pb(-1); sib.pb(head[cur]); head[cur] = u;
+        last = u;
+        return true;
+    }
+    int distinct(){ return sz(len) - 2; }
+    vector<ll> occurrences(){
+        vector<ll> occ(cnt.begin(), cnt.end());
+        for(int v = sz(len) - 1; v >= 2; --v) occ[link[v]] += occ[v]; // link[v] < v
+        return occ;
+    }
+};
+}
@@ -7,6 +7,8 @@
     Verification: 
         - https://codeforces.com/contest/808/submission/84342787      */
 
+namespace algo{
+
 template<typename T> vector<int> prefix_function(T &str){
     int n = sz(str);
     vector<int> pi(n, 0);
@@ -20,3 +22,70 @@ template<typename T> vector<int> prefix_function(T &str){
     }
     return pi;
 }
+
+/*  Overview: 
+        - KMP automaton (prefix function turned into a DFA). aut[j * al + c] = length of the longest prefix of pat
+          that is a suffix of (pat[0, j) + c), so matching is one table lookup per character with no inner while loop
+    Parts:
+        - T = Argument type (usually string)
+        - al = alphabet size, off = offset (usually 'a'). Elements must be in [off, off + al)
+        - States 0..n (n = |pat|), state n means an occurrence of pat ends at the current character
+    Usage:
+        - for(int i = 0, j = 0; i < sz(text); ++i){ j = aut[j * al + text[i] - off]; if(j == n) match ending at i }
+    Complexity: 
+        - O(n * al)
+    Verification: 
+        - N/A      */
+
+template<typename T> vector<int> kmp_automaton(const T &pat, int al, int off){
+    int n = sz(pat);
+    vector<int> pi = prefix_function(pat), aut((ll)(n + 1) * al);
+    for(int j = 0; j <= n; ++j){
+        for(int c = 0; c < al; ++c){
+            if(j < n && pat[j] - off == c) aut[(ll)j * al + c] = j + 1;
+            else aut[(ll)j * al + c] = (j == 0 ? 0 : aut[(ll)pi[j - 1] * al + c]);
+        }
+    }
+    return aut;
+}
+
+/*  Overview: 
+        - Streaming KMP matcher. Stores only the pattern and its pi[], consumes the text in pieces (buffers, mmaped
+          ranges or an istream) and reports every occurrence through a callback, so memory is O(|pat|) regardless of
+          the length of the text
+    Parts:
+        - T = Pattern type (usually string)
+        - pi[] = prefix function of pat
+        - j = length of the longest prefix of pat that is a suffix of the text fed so far
+        - pos = # of elements fed so far
+    Methods:
+        - feed(data, n, report):    Consumes n more elements, calls report(start) for every occurrence of pat starting
+                                    at absolute offset start. O(n) amortized
+        - feed(chunk, report):      Same as above for a string/vector chunk
+        - feed(in, report, buf):    Reads in until EOF in blocks of buf bytes (char patterns only)
+        - reset():                  Restarts the stream at offset 0
+    Verification: 
+        - N/A      */
+
+template<typename T> struct KmpMatcher{
+    T pat;
+    vector<int> pi;
+    int j = 0;
+    ll pos = 0;
+    KmpMatcher(const T &p): pat(p), pi(prefix_function(pat)) { assert(sz(pat) > 0); }
+    void reset(){ j = 0, pos = 0; }
+    template<typename S, typename F> void feed(const S *data, int n, F report){
+        int m = sz(pat);
+        for(int i = 0; i < n; ++i, ++pos){
+            while(j > 0 && (j == m || !(data[i] == pat[j]))) j = pi[j - 1];
+            if(data[i] == pat[j]) ++j;
+            if(j == m) report(pos - m + 1);
+        }
+    }
+    template<typename C, typename F> void feed(const C &chunk, F report){ feed(chunk.data(), sz(chunk), report); }
+    template<typename F> void feed(istream &in, F report, int buf = 1 << 16){
+        vector<char> b(buf);
+        while(in.read(b.data(), buf) || in.gcount() > 0) feed(b.data(), (int)in.gcount(), report);
+    }
+};
+}
@@ -0,0 +1,162 @@
+/*  Overview:
+        - Streaming multi-pattern Rabin-Karp matcher + fixed length substring queries, built on mersenne_hash
+          (from "Rolling Hash.cpp", include it first)
+    Parts
+        - S = single element type (usually char)
+        - HashTable = open addressing (linear probing) table from hash to pattern id, capacity = power of 2 >= 2 * # keys
+        - groups[] = one group per distinct pattern length {len, base^len, rolling hash of the last len elements, table}
+        - pats[] = all patterns concatenated, st[i] = start of pattern i in pats, nxt[i] = next pattern with the same
+          length and hash as pattern i (-1 if none)
+        - ring[] = last cap elements of the stream (cap = power of 2 > max pattern length), used to roll the window
+          and to verify every hash hit (no false positives)
+        - pos = # of elements fed so far
+    Methods:
+        - RabinKarp(patterns):  Builds the tables. O(\sum |pattern|)
+        - feed(data, n, report): Consumes n more elements of the stream, calls report(start, id) for every occurrence
+                                of pattern id starting at absolute offset start. O(n * # distinct lengths + matches * len)
+        - feed(chunk, report):  Same as above for a string/vector chunk
+        - reset():              Restarts the stream at offset 0
+        - distinct_k(str, k):   # of distinct substrings of length k. O(|str| log_2(|str|))
+        - longest_common_substring(a, b): {length, start in a, start in b} of a longest common substring, by binary
+                                search on the length. O((|a| + |b|) log_2(min(|a|, |b|)))
+    Verification:
+        - N/A
+    Assumptions:
+        - Memory is O(\sum |pattern|), independent of the length of the stream
+*/
+
+namespace algo{
+
+template<typename S> struct RabinKarp{
+    typedef unsigned long long ull;
+    struct HashTable{
+        static constexpr ull EMPTY = ~0ULL; // hashes are < 2^61 - 1 so this is never a key
+        vector<ull> keys;
+        vector<int> vals;
+        int mask = 0;
+        void init(int n){
+            int cap = 2;
+            while(cap < 2 * n) cap <<= 1;
+            keys.assign(cap, EMPTY); vals.assign(cap, -1);
+            mask = cap - 1;
+        }
+        inline int slot(ull k) const { return (k ^ (k >> 29)) & mask; }
+        int &operator[](ull k){ // inserts k with value -1 if missing
+            int i = slot(k);
+            while(keys[i] != EMPTY && keys[i] != k) i = (i + 1) & mask;
+            keys[i] = k;
+            return vals[i];
+        }
+        int find(ull k) const {
+            for(int i = slot(k); keys[i] != EMPTY; i = (i + 1) & mask){
+                if(keys[i] == k) return vals[i];
+            }
+            return -1;
+        }
+    };
+    struct Group{
+        int len;
+        ull p, h = 0;
+        HashTable table;
+    };
+    mersenne_hash mh;
+    vector<Group> groups;
+    vector<S> pats, ring;
+    vector<int> st, nxt;
+    int cap = 1;
+    ll pos = 0;
+
+    template<typename T> RabinKarp(const vector<T> &patterns){
+        int k = sz(patterns), mx = 0;
+        st.assign(k + 1, 0); nxt.assign(k, -1);
+        for(int i = 0; i < k; ++i){
+            assert(sz(patterns[i]) > 0);
+            pats.insert(pats.end(), patterns[i].begin(), patterns[i].end());
+            st[i + 1] = sz(pats);
+            ckmax(mx, sz(patterns[i]));
+        }
+        while(cap <= mx) cap <<= 1;
+        ring.assign(cap, S());
+        mh.upd(mx);
+        map<int, vector<int>> by_len;
+        for(int i = 0; i < k; ++i) by_len[sz(patterns[i])].pb(i);
+        for(auto &[len, ids] : by_len){
+            Group g;
+            g.len = len, g.p = mh.pw[len];
+            g.table.init(sz(ids));
+            for(auto i : ids){
+                ull h = 0;
+                for(int j = st[i]; j < st[i + 1]; ++j) h = mersenne_hash::mod(mersenne_hash::mul(h, mh.base) + mersenne_hash::val(pats[j]));
+                int &head = g.table[h];
+                nxt[i] = head, head = i;
+            }
+            groups.pb(g);
+        }
+    }
+
+    void reset(){
+        pos = 0;
+        for(auto &g : groups) g.h = 0;
+    }
+
+    inline bool verify(int id, ll start){
+        for(int j = st[id]; j < st[id + 1]; ++j, ++start){
+            if(!(ring[start & (cap - 1)] == pats[j])) return false;
+        }
+        return true;
+    }
+
+    template<typename F> void feed(const S *data, int n, F report){
+        for(int i = 0; i < n; ++i, ++pos){
+            ring[pos & (cap - 1)] = data[i];
+            ull v = mersenne_hash::val(data[i]);
+            for(auto &g : groups){
+                ull h = mersenne_hash::mul(g.h, mh.base) + v;
+                if(pos >= g.len) h += mersenne_hash::MOD - mersenne_hash::mul(mersenne_hash::val(ring[(pos - g.len) & (cap - 1)]), g.p);
+                g.h = mersenne_hash::mod(h);
+                if(pos + 1 < g.len) continue;
+                for(int id = g.table.find(g.h); id != -1; id = nxt[id]){
+                    if(verify(id, pos - g.len + 1)) report(pos - g.len + 1, id);
+                }
+            }
+        }
+    }
+
+    template<typename C, typename F> void feed(const C &chunk, F report){ feed(chunk.data(), sz(chunk), report); }
+};
+
+template<typename T> int distinct_k(const T &str, int k){
+    mersenne_hash mh;
+    auto w = mh.windows(mh.hash(str), k);
+    sort(w.begin(), w.end());
+    return unique(w.begin(), w.end()) - w.begin();
+}
+
+template<typename T> array<int, 3> longest_common_substring(const T &a, const T &b){
+    mersenne_hash mh;
+    auto ha = mh.hash(a), hb = mh.hash(b);
+    array<int, 3> res = {0, 0, 0};
+    auto check = [&](int len){ // finds a common substring of length len
+        if(len == 0) return true;
+        auto wa = mh.windows(ha, len), wb = mh.windows(hb, len);
+        typename RabinKarp<int>::HashTable table;
+        table.init(sz(wa));
+        for(int i = 0; i < sz(wa); ++i) table[wa[i]] = i;
+        for(int j = 0; j < sz(wb); ++j){
+            int i = table.find(wb[j]);
+            if(i >= 0 && equal(a.begin() + i, a.begin() + i + len, b.begin() + j)){
+                res = {len, i, j};
+                return true;
+            }
+        }
+        return false;
+    };
+    int lo = 0, hi = min(sz(a), sz(b));
+    while(lo < hi){
+        int mid = (lo + hi + 1)/2;
+        if(check(mid)) lo = mid;
+        else hi = mid - 1;
+    }
+    return res;
+}
+}
@@ -12,6 +12,8 @@
     Verification: 
         - https://judge.yosupo.jp/submission/13121       */
 
+namespace algo{
+
 struct rolling_hash{
     ll MOD, al, off, i_al = -1;
     vector<ll> ipw;
@@ -19,11 +21,9 @@ struct rolling_hash{
     rolling_hash(ll MOD, ll al, ll off): MOD(MOD), al(al), off(off) {}
     
     ll exp(ll a, ll r){
-        if(r == 0) return 1;
-        ll tmp = exp(a, r/2);
-        tmp = (tmp * tmp)%MOD;
-        if(r & 1) tmp = (tmp * a)%MOD;
-        return tmp;
+        ll res = 1;
+        for(a %= MOD; r; r >>= 1, a = (a * a)%MOD) if(r & 1) res = (res * a)%MOD;
+        return res;
     }
 
     void upd(int n){
@@ -50,4 +50,117 @@ struct rolling_hash{
         ll res = v[r + 1] - v[l];
         return (((ipw[l] * res)%MOD) + MOD)%MOD;
     }
-};
\ No newline at end of file
+};
+
+/*  Overview: 
+        - Polynomial Rolling Hash (Single modulo) on a modular integer type, same hashes as rolling_hash with the
+          modulus of M
+    Parts
+        - M = modular integer type from "Modular Integer.cpp" (ModInt<MOD> or DynamicModInt<ID>), MOD prime, try ~1e9
+        - al = alphabet size
+        - off = offset (usually 'a')
+        - ipw[i] = al^{-i}
+    Methods:
+        - hash(str):    Returns a vector containing prefix polynomial hashes
+                        of the given string
+        - qry(l, r):    Returns hash of substring [l, r]
+    Verification: 
+        - N/A       */
+
+template<typename M> struct mod_rolling_hash{
+    M al;
+    ll off;
+    vector<M> ipw;
+    
+    mod_rolling_hash(ll al, ll off): al(al), off(off) {}
+
+    void upd(int n){
+        if(ipw.empty()) ipw.pb(1);
+        if(sz(ipw) > n) return;
+        M i_al = al.inv();
+        while(sz(ipw) <= n) ipw.pb(ipw.back() * i_al);
+    }
+
+    template<typename T> vector<M> hash(T &str){
+        vector<M> v(sz(str) + 1);
+        upd(sz(str) + 5);
+        M pw = 1;
+        for(int i = 0; i < sz(str); ++i){
+            v[i + 1] = v[i] + M(str[i] - off + 1) * pw;
+            pw *= al;
+        }
+        return v;
+    }
+
+    M qry(int l, int r, vector<M> &v){
+        return ipw[l] * (v[r + 1] - v[l]);
+    }
+};
+
+/*  Overview: 
+        - Polynomial Rolling Hash mod the Mersenne prime 2^61 - 1 with a random base. Collision 
+          probability is ~n/2^61 per comparison, so one instance is enough (no double hashing)
+    Parts
+        - MOD = 2^61 - 1
+        - base = random base in [2^20, MOD - 2^20) chosen at runtime (or given)
+        - pw[i] = base^i
+        - h[i] = hash of the prefix of length i = \sum_{j < i} val(str[j]) * base^{i - 1 - j}
+    Methods:
+        - mul(a, b):        a * b mod MOD with one 128 bit multiply and a fold (no %). O(1)
+        - hash(str):        Returns a vector containing prefix polynomial hashes
+                            of the given string. O(|str|)
+        - qry(l, r, h):     Returns hash of substring [l, r] as h[r + 1] - h[l] * base^{r - l + 1}
+                            (forward powers, no modular inverses). O(1)
+        - windows(h, k):    Returns the hashes of all |str| - k + 1 windows of length k. Same power 
+                            for every window so the loop is just independent mul/sub. O(|str|)
+    Verification: 
+        - N/A       */
+
+struct mersenne_hash{
+    typedef unsigned long long ull;
+    static constexpr ull MOD = (1ULL << 61) - 1;
+    ull base;
+    vector<ull> pw;
+
+    mersenne_hash(){
+        mt19937_64 rng(chrono::steady_clock::now().time_since_epoch().count());
+        base = (1ULL << 20) + rng() % (MOD - (1ULL << 21));
+        pw.pb(1);
+    }
+    mersenne_hash(ull base): base(base) { pw.pb(1); }
+
+    static inline ull mod(ull x){
+        x = (x & MOD) + (x >> 61);
+        return x >= MOD ? x - MOD : x;
+    }
+    static inline ull mul(ull a, ull b){
+        __uint128_t c = (__uint128_t)a * b;
+        return mod((ull)(c & MOD) + (ull)(c >> 61));
+    }
+    template<typename S> static inline ull val(S x){ return mod((ull)x + 1); }
+
+    void upd(int n){
+        while(sz(pw) <= n) pw.pb(mul(pw.back(), base));
+    }
+
+    template<typename T> vector<ull> hash(const T &str){
+        vector<ull> h(sz(str) + 1);
+        upd(sz(str) + 1);
+        for(int i = 0; i < sz(str); ++i) h[i + 1] = mod(mul(h[i], base) + val(str[i]));
+        return h;
+    }
+
+    inline ull qry(int l, int r, const vector<ull> &h){
+        return mod(h[r + 1] + MOD - mul(h[l], pw[r - l + 1]));
+    }
+
+    vector<ull> windows(const vector<ull> &h, int k){
+        int n = sz(h) - 1;
+        if(k > n) return {};
+        vector<ull> res(n - k + 1);
+        const ull p = pw[k];
+        for(int i = 0; i + k <= n; ++i) res[i] = mod(h[i + k] + MOD - mul(h[i], p));
+        return res;
+    }
+};
+}
@@ -0,0 +1,145 @@
+/*  Overview:
+        - Persisted suffix array index. save() writes a SuffixArray (from "Suffix Array.cpp", built with build_ord() and
+          build_lcp_compact()) to a versioned binary file once, open() maps it read only with mmap so qry()/find()/count()
+          run directly against the mapped pages (zero copy, startup is O(1) and processes share the page cache).
+    Parts
+        - S = single element type of the indexed string (usually char), must be trivially copyable
+        - Header = fixed size file header {magic, version, sizeof(S), sizeof(int), byte order tag, SZ, # of big lcps,
+                   # of blocks, # of bst levels, byte offsets of every section, file size}
+        - File layout (every section 8 byte aligned, native endianness):
+            Header | text[SZ] (includes minimal) | ord[SZ] | c[SZ] | lcp8[SZ] | lcp_big[n_big] {i, lcp} | mask[SZ] | bst[L][nb]
+        - SZ, text, ord, c, lcp8, lcp_big, mask, bst = inherited from SuffixArrayView, pointing into the mapping
+    Methods:
+        - save(sa, path):   Writes sa to path. Returns false if sa is not compact (build_lcp_compact() was not called)
+                            or on I/O failure. O(SZ)
+        - open(path):       Maps path, returns false if it can not be opened, the magic/version/sizeof(S)/sizeof(int)/byte
+                            order do not match, or the sizes and section offsets do not fit the file (truncated or
+                            corrupted header). O(1)
+        - close():          Unmaps the file (also called by the destructor)
+        - lcp_at(i), rmq(l, r), qry(i, j), find(pat), count(pat): Inherited from SuffixArrayView (same code as SuffixArray)
+    Verification:
+        - N/A
+    Assumptions:
+        - POSIX (mmap). open() validates the header and the section bounds, not the section contents (a file whose
+          ord/c/lcp values were overwritten in place still opens)
+*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace algo{
+
+template<typename S> struct SuffixArrayIndex : SuffixArrayView<S>{
+    static constexpr uint32_t VERSION = 2, BYTE_ORDER_TAG = 0x01020304;
+    struct Header{
+        char magic[8];
+        uint32_t version, elem_size, int_size, byte_order;
+        uint64_t SZ, n_big, nb, L;
+        uint64_t off_text, off_ord, off_c, off_lcp8, off_big, off_mask, off_bst, file_size;
+    };
+    void *base = MAP_FAILED;
+    size_t len = 0;
+
+    // fills the section offsets and file size of h from its counts, every section 8 byte aligned
+    static void layout(Header &h){
+        uint64_t off = sizeof(Header);
+        auto section = [&](uint64_t bytes){
+            off = (off + 7) & ~7ULL;
+            uint64_t res = off;
+            off += bytes;
+            return res;
+        };
+        h.off_text = section(h.SZ * sizeof(S));
+        h.off_ord = section(h.SZ * sizeof(int));
+        h.off_c = section(h.SZ * sizeof(int));
+        h.off_lcp8 = section(h.SZ);
+        h.off_big = section(h.n_big * sizeof(pair<int, int>));
+        h.off_mask = section(h.SZ * sizeof(uint32_t));
+        h.off_bst = section(h.L * h.nb * sizeof(int));
+        h.file_size = (off + 7) & ~7ULL;
+    }
+
+    SuffixArrayIndex() {}
+    SuffixArrayIndex(const SuffixArrayIndex &) = delete;
+    SuffixArrayIndex &operator=(const SuffixArrayIndex &) = delete;
+    ~SuffixArrayIndex(){ close(); }
+
+    template<typename SA> static bool save(SA &sa, const string &path){
+        if(!sa.compact || sa.nb == 0) return false;
+        Header h{};
+        memcpy(h.magic, "SAIDX\0\0\0", 8);
+        h.version = VERSION, h.elem_size = sizeof(S), h.int_size = sizeof(int), h.byte_order = BYTE_ORDER_TAG;
+        h.SZ = sa.SZ, h.n_big = sz(sa.lcp_big), h.nb = sa.nb, h.L = sz(sa.bst) / sa.nb;
+        layout(h);
+        ofstream out(path, ios::binary | ios::trunc);
+        if(!out) return false;
+        uint64_t pos = 0;
+        auto put = [&](uint64_t at, const void *p, uint64_t bytes){
+            static const char zero[8] = {};
+            out.write(zero, at - pos);
+            out.write((const char *)p, bytes);
+            pos = at + bytes;
+        };
+        vector<S> text(sa.str.begin(), sa.str.begin() + sa.SZ);
+        put(0, &h, sizeof(Header));
+        put(h.off_text, text.data(), h.SZ * sizeof(S));
+        put(h.off_ord, sa.ord.data(), h.SZ * sizeof(int));
+        put(h.off_c, sa.c.data(), h.SZ * sizeof(int));
+        put(h.off_lcp8, sa.lcp8.data(), h.SZ);
+        put(h.off_big, sa.lcp_big.data(), h.n_big * sizeof(pair<int, int>));
+        put(h.off_mask, sa.mask.data(), h.SZ * sizeof(uint32_t));
+        put(h.off_bst, sa.bst.data(), h.L * h.nb * sizeof(int));
+        put(h.file_size, nullptr, 0);
+        return (bool)out.flush();
+    }
+
+    bool open(const string &path){
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0) return false;
+        struct stat st;
+        if(fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(Header)){
+            ::close(fd);
+            return false;
+        }
+        len = st.st_size;
+        base = mmap(nullptr, len, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if(base == MAP_FAILED) return false;
+        const Header &h = *(const Header *)base;
+        // the counts must be consistent (bounded first so layout() can not overflow) and every offset must match the
+        // layout save() writes for them, which puts every section inside the file
+        bool ok = !memcmp(h.magic, "SAIDX\0\0\0", 8) && h.version == VERSION && h.elem_size == sizeof(S) &&
+                  h.int_size == sizeof(int) && h.byte_order == BYTE_ORDER_TAG && h.SZ > 0 && h.SZ <= INT_MAX &&
+                  h.n_big <= h.SZ && h.nb == (h.SZ + 31) >> 5 && h.L == (uint64_t)__lg(h.nb) + 1;
+        if(ok){
+            Header e = h;
+            layout(e);
+            ok = e.off_text == h.off_text && e.off_ord == h.off_ord && e.off_c == h.off_c && e.off_lcp8 == h.off_lcp8 &&
+                 e.off_big == h.off_big && e.off_mask == h.off_mask && e.off_bst == h.off_bst &&
+                 e.file_size == h.file_size && h.file_size == len;
+        }
+        if(!ok){
+            close();
+            return false;
+        }
+        const char *p = (const char *)base;
+        this->SZ = h.SZ, this->nb = h.nb, this->n_big = h.n_big;
+        this->text = (const S *)(p + h.off_text);
+        this->ord = (const int *)(p + h.off_ord);
+        this->c = (const int *)(p + h.off_c);
+        this->lcp8 = (const uint8_t *)(p + h.off_lcp8);
+        this->lcp_big = (const pair<int, int> *)(p + h.off_big);
+        this->mask = (const uint32_t *)(p + h.off_mask);
+        this->bst = (const int *)(p + h.off_bst);
+        madvise(base, len, MADV_RANDOM);
+        return true;
+    }
+
+    void close(){
+        if(base != MAP_FAILED) munmap(base, len);
+        base = MAP_FAILED, len = 0, this->SZ = 0;
+    }
+};
+}
@@ -1,5 +1,5 @@
 /*  Overview: 
-        - Suffix Array (Sort suffixes of a string in O(SZ log_2(SZ)) and 
+        - Suffix Array (Sort suffixes of a string in O(SZ) with SA-IS and 
           query longest common prefixes between suffixes in O(1)) after 
           O(SZ log_2(SZ)) preprocessing.
     Parts
@@ -9,32 +9,67 @@
         - ord[i] = ith smallest prefix of string. 0th smallest is just the minimal element that was appended w/ constructor
         - lcp[i] = Longest common prefix between the ith and i+1th elements of ord[]
         - st = Minimum sparse table of lcp[]
-        CHANGE st to min segment tree with small memory limits for build_lcp() in O(SZ) and qry(i, j) in O(log_2(SZ)).
+        - compact = true if build_lcp_compact() was used instead of build_lcp() (lcp[] and st are then empty)
+        - lcp8[i] = min(lcp[i], 255), lcp_big = sorted {i, lcp[i]} for every lcp[i] >= 255
+        - mask[i] = bitmask of the min stack of lcp over [32 * (i / 32), i], nb = # of 32 blocks
+        - bst[j * nb + b] = min of lcp over blocks [b, b + 2^j) (flat sparse table)
+        - SuffixArrayView = the compact lcp queries and find()/count() written once over raw pointers, shared with the
+          mmap'd SuffixArrayIndex ("Suffix Array Index.cpp")
+        USE build_lcp_compact() with small memory limits: after build_ord() + build_lcp_compact() the object holds
+        ~16 bytes/char (str, ord, c, lcp8, mask, measured 16.4 for 10^7 random chars) instead of ~4(log_2(SZ) + 5)
+        bytes/char with lcp[] and st. build_ord() peaks at ~50 bytes/char while its SAIS workspace is alive.
         Important things: Print out arrays before using because indexing is non-standard
     Methods:
+        - sa_is(s, upper):  Suffix array of s (values in [0, upper]) by induced sorting (Nong, Zhang, Chan). O(SZ + upper)
+        - SAIS::build(s, upper, sa): Same into sa, every recursion level takes its arrays from one reusable pool
+                            (~9 SZ + 3 upper ints), so repeated builds with the same workspace do not allocate
+        - build_ord():      Generates suffix array (ord[]) and c[] from the given string with a temporary SAIS workspace
+                            (freed before returning). Characters are compressed to [1, K] first (direct table for 1/2
+                            byte integral S, sort otherwise). O(SZ)
+        - build_ord(ws):    Same with a caller owned workspace (ws.rk[] = compressed text), so repeated builds do not
+                            allocate. The workspace holds ~40 bytes/char until the caller frees it
         - count_sort():     Counting sort ord. Used as a helper function. O(SZ)
-        - build_ord():      Generates suffix array (ord[]) from the given string. O(SZ log_2(SZ))
+        - build_ord_doubling(): Old prefix doubling construction, same outputs as build_ord(). O(SZ log_2(SZ))
         - build_lcp():      Generates lcp[] using Kasai, Lee, Arimura, Arikawa, and Park linear 
                             LCP algorithm. O(SZ log SZ)
+        - build_lcp_compact(): Generates lcp8[]/lcp_big[] with the Phi (PLCP) algorithm and the O(SZ) memory
+                            block RMQ over them. O(SZ)
+        - lcp_at(i):        lcp[i] in either mode. O(1) (O(log_2(SZ)) for compact values >= 255)
+        - view():           SuffixArrayView over the member arrays (valid until the next build). O(1)
+        - rmq(l, r):        min(lcp[l, r]) in compact mode. O(1)
         - qry(i, j):        Returns LCP between suffix str[i, SZ - 1] and str[j, SZ - 1]. O(1)
+        - qry(qs):          Batched qry() for {i, j} pairs, answered in rank order for locality. O(|qs| log_2(|qs|))
+        - find(pat):        [lo, hi) range of ord[] whose suffixes start with pat. O(|pat| log_2(SZ))
+        - count(pat):       # of occurrences of pat. O(|pat| log_2(SZ))
+        - longest_repeated(): {position, length} of a longest substring occurring at least twice. O(SZ)
+        - distinct_substrings(): # of distinct non-empty substrings. O(SZ)
     Verification: 
         - https://codeforces.com/edu/course/2/lesson/2/5/practice/contest/269656/submission/85568680
         - https://codeforces.com/edu/course/2/lesson/2/5/practice/contest/269656/submission/85728550
         - https://codeforces.com/edu/course/2/lesson/2/5/practice/contest/269656/submission/85789969
-        - https://codeforces.com/edu/course/2/lesson/2/5/practice/contest/269656/submission/85801898        */
+        - https://codeforces.com/edu/course/2/lesson/2/5/practice/contest/269656/submission/85801898
+        - sa_is(): N/A (checked against build_ord_doubling())
+        - build_lcp_compact(), qry(qs), find(), count(), longest_repeated(), distinct_substrings(): N/A
+    Source:
+        - sa_is() adapted from AtCoder Library (https://github.com/atcoder/ac-library/blob/master/atcoder/string.hpp)        */
+
+namespace algo{
 
 // Sparse Table included for convenience (same as "Sparse Table.cpp")
+#ifndef SPARSE_TABLE
+#define SPARSE_TABLE
 template<typename T> struct SparseTable{
-    int SZ, L;
+    int SZ = 0, L = 0;
     vector<int> logs;
     vector<vector<T>> table;
     T cmb(T x, T y){ return min(x, y); }
     SparseTable(){};
-    SparseTable(int size, vector<T> &v): SZ(size){
+    SparseTable(int size, vector<T> &v){ build(size, v); }
+    SparseTable(T id, int size, vector<T> &v): SZ(size){
         L = log2(SZ) + 1;
         logs.assign(SZ + 1, 0);
         for(int i = 2; i <= SZ; ++i) logs[i] = logs[i >> 1] + 1;
-        table.assign(L + 1, vector<T>(SZ, 0));
+        table.assign(L + 1, vector<T>(SZ, id));
         build(v);
     }
     void build(int size, vector<T> &v){
@@ -42,7 +77,7 @@ template<typename T> struct SparseTable{
         L = log2(SZ) + 1;
         logs.assign(SZ + 1, 0);
         for(int i = 2; i <= SZ; ++i) logs[i] = logs[i >> 1] + 1;
-        table.assign(L + 1, vector<T>(SZ, 0));
+        table.assign(L + 1, vector<T>(SZ, T()));
         build(v);
     }
     void build(vector<T> &v){
@@ -58,11 +93,171 @@ template<typename T> struct SparseTable{
         return cmb(table[j][l], table[j][r - (1 << j) + 1]);
     }
 };
+#endif
+
+// SA-IS workspace. pool/lpool are stacks: every recursion level takes its arrays on entry and gives them back on exit
+struct SAIS{
+    vector<int> rk; // compressed text, filled by SuffixArray::build_ord(ws)
+    vector<int> pool;
+    vector<uint8_t> lpool;
+    size_t top = 0, ltop = 0;
+    int *take(size_t k){
+        int *p = pool.data() + top;
+        top += k;
+        assert(top <= pool.size());
+        return p;
+    }
+    void build(const vector<int> &s, int upper, vector<int> &sa){
+        int n = sz(s);
+        sa.resize(n);
+        if((ll)sz(pool) < 9LL * n + 3LL * upper + 300) pool.resize(9LL * n + 3LL * upper + 300); // bound on every level
+        if(sz(lpool) < 2 * n + 2) lpool.resize(2 * n + 2);
+        top = ltop = 0;
+        run(s.data(), n, upper, sa.data());
+    }
+    void run(const int *s, int n, int upper, int *sa){ // sa[0, n) = suffix array of s[0, n)
+        if(n == 0) return;
+        if(n == 1){ sa[0] = 0; return; }
+        if(n == 2){ sa[0] = (s[0] < s[1] ? 0 : 1), sa[1] = 1 - sa[0]; return; }
+        size_t t0 = top, l0 = ltop;
+        int *sum_l = take(upper + 1), *sum_s = take(upper + 1), *buf = take(upper + 1);
+        fill(sum_l, sum_l + upper + 1, 0); fill(sum_s, sum_s + upper + 1, 0);
+        uint8_t *ls = lpool.data() + ltop; // ls[i] = suffix i is S-type
+        ltop += n;
+        ls[n - 1] = 0;
+        for(int i = n - 2; i >= 0; --i) ls[i] = (s[i] == s[i + 1]) ? ls[i + 1] : (s[i] < s[i + 1]);
+        for(int i = 0; i < n; ++i){
+            if(!ls[i]) ++sum_s[s[i]];
+            else ++sum_l[s[i] + 1];
+        }
+        for(int i = 0; i <= upper; ++i){ // sum_l[c] = start of bucket c, sum_s[c] = start of S-type part of bucket c
+            sum_s[i] += sum_l[i];
+            if(i < upper) sum_l[i + 1] += sum_s[i];
+        }
+        auto induce = [&](const int *lms, int k){
+            fill(sa, sa + n, -1);
+            copy(sum_s, sum_s + upper + 1, buf);
+            for(int j = 0; j < k; ++j) if(lms[j] != n) sa[buf[s[lms[j]]]++] = lms[j];
+            copy(sum_l, sum_l + upper + 1, buf);
+            sa[buf[s[n - 1]]++] = n - 1;
+            for(int i = 0; i < n; ++i){
+                int v = sa[i];
+                if(v >= 1 && !ls[v - 1]) sa[buf[s[v - 1]]++] = v - 1;
+            }
+            copy(sum_l, sum_l + upper + 1, buf);
+            for(int i = n - 1; i >= 0; --i){
+                int v = sa[i];
+                if(v >= 1 && ls[v - 1]) sa[--buf[s[v - 1] + 1]] = v - 1;
+            }
+        };
+        int *lms_map = take(n + 1), m = 0;
+        fill(lms_map, lms_map + n + 1, -1);
+        for(int i = 1; i < n; ++i) if(!ls[i - 1] && ls[i]) lms_map[i] = m++;
+        int *lms = take(m);
+        for(int i = 1, j = 0; i < n; ++i) if(!ls[i - 1] && ls[i]) lms[j++] = i;
+        induce(lms, m);
+        if(m){ // sort LMS substrings recursively
+            int *sorted_lms = take(m), *rec_s = take(m), *rec_sa = take(m);
+            for(int i = 0, j = 0; i < n; ++i) if(lms_map[sa[i]] != -1) sorted_lms[j++] = sa[i];
+            int rec_upper = 0;
+            rec_s[lms_map[sorted_lms[0]]] = 0;
+            for(int i = 1; i < m; ++i){
+                int l = sorted_lms[i - 1], r = sorted_lms[i];
+                int end_l = (lms_map[l] + 1 < m) ? lms[lms_map[l] + 1] : n;
+                int end_r = (lms_map[r] + 1 < m) ? lms[lms_map[r] + 1] : n;
+                bool same = true;
+                if(end_l - l != end_r - r) same = false;
+                else{
+                    while(l < end_l && s[l] == s[r]) ++l, ++r;
+                    if(l == n || s[l] != s[r]) same = false;
+                }
+                if(!same) ++rec_upper;
+                rec_s[lms_map[sorted_lms[i]]] = rec_upper;
+            }
+            run(rec_s, m, rec_upper, rec_sa);
+            for(int i = 0; i < m; ++i) sorted_lms[i] = lms[rec_sa[i]];
+            induce(sorted_lms, m);
+        }
+        top = t0, ltop = l0;
+    }
+};
+
+// SA-IS, returns suffix array of s where 0 <= s[i] <= upper
+inline vector<int> sa_is(const vector<int> &s, int upper){
+    SAIS w;
+    vector<int> sa;
+    w.build(s, upper, sa);
+    return sa;
+}
+
+template<typename S> struct SuffixArrayView{
+    int SZ = 0, nb = 0;
+    ll n_big = 0;
+    const S *text = nullptr;
+    const int *ord = nullptr, *c = nullptr, *bst = nullptr;
+    const uint8_t *lcp8 = nullptr;
+    const pair<int, int> *lcp_big = nullptr;
+    const uint32_t *mask = nullptr;
+    inline int lcp_at(int i) const {
+        if(lcp8[i] < 255) return lcp8[i];
+        return lower_bound(lcp_big, lcp_big + n_big, make_pair(i, 0))->s;
+    }
+    inline int in_block(int l, int r) const { return lcp_at(l + __builtin_ctz(mask[r] >> (l & 31))); }
+    int rmq(int l, int r) const {
+        int bl = l >> 5, br = r >> 5;
+        if(bl == br) return in_block(l, r);
+        int res = min(in_block(l, (bl << 5) + 31), in_block(br << 5, r));
+        if(bl + 1 < br){
+            int j = __lg(br - bl - 1);
+            ckmin(res, min(bst[(ll)j * nb + bl + 1], bst[(ll)j * nb + br - (1 << j)]));
+        }
+        return res;
+    }
+    int qry(int i, int j) const {
+        if(i == j) return SZ - i;
+        i = c[i], j = c[j];
+        if(i > j) swap(i, j);
+        return rmq(i + 1, j);
+    }
+    // <0, 0, >0 if the first |pat| characters of suffix p are less than, equal to, greater than pat
+    template<typename P> int cmp(int p, const P &pat) const {
+        for(int k = 0; k < sz(pat); ++k){
+            if(p + k >= SZ - 1) return -1;
+            if(text[p + k] != pat[k]) return text[p + k] < pat[k] ? -1 : 1;
+        }
+        return 0;
+    }
+    template<typename P> pair<int, int> find(const P &pat) const {
+        int lo = 0, hi = SZ;
+        while(lo < hi){
+            int mid = lo + (hi - lo)/2;
+            if(cmp(ord[mid], pat) < 0) lo = mid + 1;
+            else hi = mid;
+        }
+        int l = lo; hi = SZ;
+        while(lo < hi){
+            int mid = lo + (hi - lo)/2;
+            if(cmp(ord[mid], pat) <= 0) lo = mid + 1;
+            else hi = mid;
+        }
+        return {l, lo};
+    }
+    template<typename P> int count(const P &pat) const {
+        auto [l, r] = find(pat);
+        return r - l;
+    }
+};
 
 template<typename T, typename S> struct SuffixArray{
     int SZ; T str;
+    bool compact = false;
     vector<int> lcp, c, ord;
     SparseTable<int> st;
+    vector<uint8_t> lcp8;
+    vector<pair<int, int>> lcp_big;
+    vector<uint32_t> mask;
+    vector<int> bst;
+    int nb = 0;
     SuffixArray() {};
     SuffixArray(T s, S minimal, int size): str(s), SZ(size + 1), st(){
         str.pb(minimal);
@@ -82,6 +277,33 @@ template<typename T, typename S> struct SuffixArray{
         build_ord();
     }
     void build_ord(){
+        SAIS ws;
+        build_ord(ws);
+    }
+    void build_ord(SAIS &ws){
+        vector<int> &rk = ws.rk;
+        rk.resize(SZ);
+        int upper = 0;
+        if constexpr(is_integral_v<S> && sizeof(S) <= 2){
+            constexpr int K = 1 << (8 * sizeof(S));
+            vector<int> id(K, 0);
+            for(int i = 0; i < SZ - 1; ++i) id[(int)str[i] - (int)numeric_limits<S>::min()] = 1;
+            for(int i = 0; i < K; ++i) if(id[i]) id[i] = ++upper;
+            for(int i = 0; i < SZ - 1; ++i) rk[i] = id[(int)str[i] - (int)numeric_limits<S>::min()];
+        }
+        else{
+            vector<S> vals(str.begin(), str.begin() + SZ - 1);
+            sort(vals.begin(), vals.end());
+            vals.erase(unique(vals.begin(), vals.end()), vals.end());
+            for(int i = 0; i < SZ - 1; ++i) rk[i] = lower_bound(vals.begin(), vals.end(), str[i]) - vals.begin() + 1;
+            upper = sz(vals);
+        }
+        rk[SZ - 1] = 0; // minimal
+        ws.build(rk, upper, ord);
+        c.assign(SZ, 0);
+        for(int i = 0; i < SZ; ++i) c[ord[i]] = i;
+    }
+    void build_ord_doubling(){
         ord.assign(SZ, 0); c.assign(SZ, 0);
         int k = 0;
         vector<pair<S, int>> pre(SZ);
@@ -120,20 +342,90 @@ template<typename T, typename S> struct SuffixArray{
         }
         st.build(SZ, lcp);
     }
+    void build_lcp_compact(){
+        compact = true;
+        lcp.clear(); lcp.shrink_to_fit(); st = SparseTable<int>();
+        vector<int> phi(SZ); // phi[ord[i]] = ord[i - 1], then overwritten by plcp[] in text order
+        for(int i = 1; i < SZ; ++i) phi[ord[i]] = ord[i - 1];
+        for(int i = 0, k = 0; i < SZ - 1; ++i){
+            while(str[i + k] == str[phi[i] + k]) ++k;
+            phi[i] = k;
+            k = max(k - 1, 0);
+        }
+        phi[SZ - 1] = 0;
+        lcp8.assign(SZ, 0); lcp_big.clear();
+        for(int i = 1; i < SZ; ++i){
+            int v = phi[ord[i]];
+            if(v < 255) lcp8[i] = v;
+            else lcp8[i] = 255, lcp_big.pb({i, v});
+        }
+        phi = vector<int>();
+        nb = (SZ + 31) >> 5;
+        int nl = __lg(nb) + 1;
+        bst.assign((ll)nl * nb, INT_MAX);
+        mask.assign(SZ, 0);
+        auto v = view();
+        for(int b = 0; b < nb; ++b){
+            uint32_t cur = 0;
+            for(int i = b << 5; i < min(SZ, (b + 1) << 5); ++i){
+                int x = v.lcp_at(i);
+                while(cur && v.lcp_at((b << 5) + 31 - __builtin_clz(cur)) >= x) cur ^= 1u << (31 - __builtin_clz(cur));
+                cur |= 1u << (i & 31);
+                mask[i] = cur;
+                ckmin(bst[b], x);
+            }
+        }
+        for(int j = 1; j < nl; ++j){
+            for(int b = 0; b + (1 << j) <= nb; ++b){
+                bst[(ll)j * nb + b] = min(bst[(ll)(j - 1) * nb + b], bst[(ll)(j - 1) * nb + b + (1 << (j - 1))]);
+            }
+        }
+    }
+    SuffixArrayView<S> view(){
+        return {SZ, nb, sz(lcp_big), str.data(), ord.data(), c.data(), bst.data(), lcp8.data(), lcp_big.data(), mask.data()};
+    }
+    inline int lcp_at(int i){ return compact ? view().lcp_at(i) : lcp[i]; }
+    int rmq(int l, int r){ return view().rmq(l, r); }
     // //common characters between suffix i and suffix j
     int qry(int i, int j){
+        if(compact) return view().qry(i, j);
         if(i == j) return SZ - i;
         i = c[i], j = c[j];
         if(i > j) swap(i, j);
         return st.qry(i + 1, j);
     }
+    vector<int> qry(const vector<pair<int, int>> &qs){
+        vector<int> order(sz(qs)), res(sz(qs));
+        iota(order.begin(), order.end(), 0);
+        sort(order.begin(), order.end(), [&](int a, int b){
+            return min(c[qs[a].f], c[qs[a].s]) < min(c[qs[b].f], c[qs[b].s]);
+        });
+        for(auto i : order) res[i] = qry(qs[i].f, qs[i].s);
+        return res;
+    }
+    pair<int, int> find(const T &pat){ return view().find(pat); }
+    int count(const T &pat){ return view().count(pat); }
+    pair<int, int> longest_repeated(){
+        pair<int, int> res = {0, 0};
+        for(int i = 1; i < SZ; ++i){
+            int v = lcp_at(i);
+            if(v > res.s) res = {ord[i], v};
+        }
+        return res;
+    }
+    ll distinct_substrings(){
+        ll res = 0;
+        for(int i = 1; i < SZ; ++i) res += (SZ - 1 - ord[i]) - lcp_at(i);
+        return res;
+    }
     void print(){
         cout << "Suffix Array: ";
         for(auto i : ord) cout << i << " ";
         cout << "\nLCP Array: ";
-        for(auto i : lcp) cout << i << " ";
+        for(int i = 0; i < (compact ? SZ : sz(lcp)); ++i) cout << lcp_at(i) << " ";
         cout << "\nInverse Permutation: ";
         for(auto i : c) cout << i << " ";
         cout << "\n";
     }
-};
\ No newline at end of file
+};
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+/*  Overview:
+        - Online suffix automaton. O(n) construction by appending one element at a time with extend(), so an append only
+          corpus never needs a rebuild
+    Parts
+        - E = transition storage, DenseEdges or SparseEdges:
+            - DenseEdges: go[v * al + c], O(1) lookups, al ints per state. Use it for small alphabets
+            - SparseEdges: the edges of v are pool[beg[v], beg[v] + cnt[v]) sorted by element, O(log(degree)) binary
+              search lookups and O(degree) inserts (the sorted insert shifts the larger edges), a full list is moved to
+              the end of the pool with twice the capacity. O(# transitions) memory for any alphabet
+        - al = alphabet size, off = offset (usually 'a'). Elements must be in [off, off + al)
+        - State 0 = root (empty string), last = state of the whole string
+        - len[v] = length of the longest string of v, link[v] = suffix link (-1 for the root)
+        - endpos[v] = end position of the first occurrence of the strings of v
+        - occ[v] = # of occurrences of the strings of v (computed lazily, stale after extend())
+        - distinct = # of distinct non-empty substrings, maintained by extend()
+    Methods:
+        - extend(x):            Appends element x. O(1) amortized (* degree for SparseEdges)
+        - walk(pat):            State reached by pat from the root (-1 if pat is not a substring). O(|pat|)
+        - contains(pat):        true iff pat is a substring. O(|pat|)
+        - count(pat):           # of occurrences of pat. O(|pat|), plus O(n) after an extend()
+        - first_occurrence(pat): Start of the first occurrence of pat (-1 if none). O(|pat|)
+        - lcs(others):          {length, start} of a longest string that is a substring of the automaton's string and
+                                of every string in others. O(n + \sum |others|)
+    Verification:
+        - N/A
+    Assumptions:
+        - At most 2n - 1 states and 3n - 4 transitions for a string of length n
+*/
+
+namespace algo{
+
+struct DenseEdges{
+    int al;
+    vector<int> go;
+    DenseEdges(int al): al(al) {}
+    void add_state(){ go.resize(sz(go) + al, -1); }
+    inline int get(int v, int c) const { return go[(ll)v * al + c]; }
+    inline void set(int v, int c, int u){ go[(ll)v * al + c] = u; }
+    void clone(int from, int to){ copy_n(go.begin() + (ll)from * al, al, go.begin() + (ll)to * al); }
+};
+
+struct SparseEdges{
+    vector<pair<int, int>> pool; // {element, target}
+    vector<int> beg, cnt, cap;
+    SparseEdges(int) {}
+    void add_state(){ beg.pb(sz(pool)); cnt.pb(0); cap.pb(0); }
+    inline int lb(int v, int c) const {
+        int lo = beg[v], hi = beg[v] + cnt[v];
+        while(lo < hi){
+            int mid = (lo + hi)/2;
+            if(pool[mid].f < c) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+    inline int get(int v, int c) const {
+        int i = lb(v, c);
+        return (i < beg[v] + cnt[v] && pool[i].f == c) ? pool[i].s : -1;
+    }
+    void move(int v, int c){ // moves the edges of v to the end of the pool with capacity c
+        int b = sz(pool);
+        pool.resize(b + c);
+        for(int i = 0; i < cnt[v]; ++i) pool[b + i] = pool[beg[v] + i];
+        beg[v] = b, cap[v] = c;
+    }
+    void set(int v, int c, int u){
+        int i = lb(v, c);
+        if(i < beg[v] + cnt[v] && pool[i].f == c){
+            pool[i].s = u;
+            return;
+        }
+        if(cnt[v] == cap[v]){
+            i -= beg[v];
+            move(v, max(2, 2 * cap[v]));
+            i += beg[v];
+        }
+        for(int j = beg[v] + cnt[v]; j > i; --j) pool[j] = pool[j - 1];
+        pool[i] = {c, u};
+        ++cnt[v];
+    }
+    void clone(int from, int to){
+        beg[to] = beg[from], cnt[to] = cnt[from];
+        move(to, cnt[from]);
+    }
+};
+
+template<typename E> struct SuffixAutomaton{
+    int al, off, last = 0;
+    ll distinct = 0;
+    bool stale = true;
+    E e;
+    vector<int> len, link, endpos, occ;
+
+    SuffixAutomaton(int al, int off, int reserve = 0): al(al), off(off), e(al){
+        for(auto v : {&len, &link, &endpos, &occ}) v->reserve(2 * reserve + 1);
+        new_state(0, -1);
+    }
+
+    int new_state(int l, int p){
+        len.pb(l); link.pb(-1); endpos.pb(p); occ.pb(0);
+        e.add_state();
+        return sz(len) - 1;
+    }
+
+    void extend(int x){
+        int c = x - off, cur = new_state(len[last] + 1, len[last]), p = last;
+        for(; p != -1 && e.get(p, c) == -1; p = link[p]) e.set(p, c, cur);
+        if(p == -1) link[cur] = 0;
+        else{
+            int q = e.get(p, c);
+            if(len[p] + 1 == len[q]) link[cur] = q;
+            else{
+                int cl = new_state(len[p] + 1, endpos[q]);
+                e.clone(q, cl);
+                link[cl] = link[q];
+                for(; p != -1 && e.get(p, c) == q; p = link[p]) e.set(p, c, cl);
+                link[q] = link[cur] = cl;
+            }
+        }
+        last = cur;
+        distinct += len[cur] - len[link[cur]];
+        stale = true;
+    }
+
+    vector<int> by_len(){ // states sorted by len (counting sort)
+        int n = sz(len);
+        vector<int> b(len[last] + 2, 0), res(n);
+        for(int v = 0; v < n; ++v) ++b[len[v] + 1];
+        for(int i = 1; i < sz(b); ++i) b[i] += b[i - 1];
+        for(int v = 0; v < n; ++v) res[b[len[v]]++] = v;
+        return res;
+    }
+
+    template<typename T> int walk(const T &pat){
+        int v = 0;
+        for(auto x : pat){
+            if(x - off < 0 || x - off >= al || (v = e.get(v, x - off)) == -1) return -1;
+        }
+        return v;
+    }
+    template<typename T> bool contains(const T &pat){ return walk(pat) != -1; }
+    template<typename T> int count(const T &pat){
+        if(stale){
+            for(int v = 0; v < sz(len); ++v) occ[v] = (v > 0 && endpos[v] == len[v] - 1); // clones have endpos[v] > len[v] - 1
+            auto ord = by_len();
+            for(int i = sz(ord) - 1; i > 0; --i) occ[link[ord[i]]] += occ[ord[i]];
+            stale = false;
+        }
+        int v = walk(pat);
+        return v == -1 ? 0 : occ[v];
+    }
+    template<typename T> int first_occurrence(const T &pat){
+        int v = walk(pat);
+        return v == -1 ? -1 : endpos[v] - sz(pat) + 1;
+    }
+
+    template<typename T> pair<int, int> lcs(const vector<T> &others){
+        int n = sz(len);
+        vector<int> best(len), cur(n), ord = by_len();
+        for(auto &t : others){
+            fill(cur.begin(), cur.end(), 0);
+            int v = 0, l = 0;
+            for(auto x : t){
+                int c = x - off, u = (c < 0 || c >= al) ? -1 : e.get(v, c);
+                while(v > 0 && u == -1){
+                    v = link[v], l = len[v];
+                    u = (c < 0 || c >= al) ? -1 : e.get(v, c);
+                }
+                if(u == -1) v = 0, l = 0;
+                else v = u, ++l;
+                ckmax(cur[v], l);
+            }
+            for(int i = n - 1; i > 0; --i){
+                int v = ord[i], p = link[v];
+                ckmax(cur[p], min(cur[v], len[p]));
+                ckmin(best[v], cur[v]);
+            }
+            best[0] = 0;
+        }
+        pair<int, int> res = {0, 0};
+        for(int v = 1; v < n; ++v) if(best[v] > res.f) res = {best[v], endpos[v] - best[v] + 1};
+        return res;
+    }
+};
+}
@@ -6,6 +6,8 @@
         - O(n)
     Verification: 
         - https://judge.yosupo.jp/submission/17094      */
+namespace algo{
+
 template<typename T> vector<int> calc(T &str){
     int n = sz(str);
     vector<int> z(n);
@@ -20,4 +22,80 @@ template<typename T> vector<int> calc(T &str){
     }
     if(n) z[0] = n;
     return z;
-}
\ No newline at end of file
+}
+
+/*  Overview: 
+        - Streaming Z matcher. For every position i of a text consumed in pieces, reports z[i] = LCP(text[i, ...], pat)
+          (capped at |pat|, and at the end of the text for the last positions) with memory O(|pat|)
+    Parts:
+        - T = Pattern type (usually string)
+        - pi[] = prefix function of pat, up[b] = longest proper border b' of pat[0, b) with pat[b'] != pat[b] (-1 if none)
+        - j = longest prefix of pat that is a suffix of the text so far. Positions that still match (alive) are
+          exactly pos - b for every b on the border chain of j
+        - min_len = only positions with z[i] >= min_len are reported
+    Method:
+        - When element c arrives, walk the border chain of j: borders b with pat[b] != c die (z[pos - b] = b), borders
+          with pat[b] == c survive and up[b] skips every following border that also survives. Every step of the walk
+          reports a position, so this is O(1) amortized per element
+    Methods:
+        - feed(data, n, report):    Consumes n more elements, calls report(i, z[i]) for every position whose z value is
+                                    now known (not in increasing order of i). O(n) amortized
+        - feed(chunk, report):      Same as above for a string/vector chunk
+        - feed(in, report, buf):    Reads in until EOF in blocks of buf bytes (char patterns only), then calls flush()
+        - flush(report):            Text ended, reports the positions still alive
+    Verification: 
+        - N/A      */
+
+template<typename T> struct ZMatcher{
+    T pat;
+    vector<int> pi, up;
+    int j = 0, min_len;
+    ll pos = 0;
+    ZMatcher(const T &p, int min_len = 1): pat(p), min_len(min_len){
+        int m = sz(pat);
+        assert(m > 0);
+        pi.assign(m, 0); up.assign(m, -1);
+        for(int i = 1; i < m; ++i){
+            int k = pi[i - 1];
+            while(k > 0 && pat[i] != pat[k]) k = pi[k - 1];
+            if(pat[i] == pat[k]) ++k;
+            pi[i] = k;
+        }
+        for(int b = 1; b < m; ++b){
+            int p = pi[b - 1];
+            up[b] = (pat[p] != pat[b] ? p : up[p]);
+        }
+    }
+    template<typename S, typename F> void feed(const S *data, int n, F report){
+        int m = sz(pat);
+        for(int i = 0; i < n; ++i, ++pos){
+            int nj = 0;
+            for(int b = j; b != -1;){
+                if(data[i] == pat[b]){
+                    if(!nj) nj = b + 1;
+                    b = up[b];
+                }
+                else{
+                    if(b >= min_len) report(pos - b, b);
+                    b = (b == 0 ? -1 : pi[b - 1]);
+                }
+            }
+            if(nj == m){
+                if(m >= min_len) report(pos - m + 1, m);
+                nj = pi[m - 1];
+            }
+            j = nj;
+        }
+    }
+    template<typename C, typename F> void feed(const C &chunk, F report){ feed(chunk.data(), sz(chunk), report); }
+    template<typename F> void flush(F report){
+        for(int b = j; b > 0; b = pi[b - 1]) if(b >= min_len) report(pos - b, b);
+        j = 0;
+    }
+    template<typename F> void feed(istream &in, F report, int buf = 1 << 16){
+        vector<char> b(buf);
+        while(in.read(b.data(), buf) || in.gcount() > 0) feed(b.data(), (int)in.gcount(), report);
+        flush(report);
+    }
+};
+}
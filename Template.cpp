@@ -5,6 +5,18 @@ using namespace std;
 typedef long double ld;
 typedef long long ll;
 
+// every module is declared in namespace algo, idx = index type of the Fenwick trees and DSU
+namespace algo{
+#ifdef ALGO_INDEX64
+typedef long long idx;
+#else
+typedef int idx;
+#endif
+}
+#ifndef ALGO_NO_MAIN
+using namespace algo;
+#endif
+
 #define sz(x) (int)(x).size()
 #define pb push_back
 #define mp make_pair
@@ -14,9 +26,11 @@ typedef long long ll;
 template<typename T, typename U> bool ckmin(T &a, U b){ return b < a ? a = b, true : false; }
 template<typename T, typename U> bool ckmax(T &a, U b){ return b > a ? a = b, true : false; }
 
+#ifndef ALGO_NO_MAIN
 int main(){
     ios_base::sync_with_stdio(false);
     cin.tie(NULL);
     
     return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file